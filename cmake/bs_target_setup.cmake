@@ -51,5 +51,8 @@ function(bs_target_setup target)
     if (${BUGSPRAY_DONT_USE_STD_STRING})
         target_compile_definitions(${target} PUBLIC BUGSPRAY_DONT_USE_STD_STRING)
     endif ()
+    if (${BUGSPRAY_ENABLE_USDT_PROBES})
+        target_compile_definitions(${target} PUBLIC BUGSPRAY_ENABLE_USDT_PROBES)
+    endif ()
 
 endfunction()
\ No newline at end of file
@@ -0,0 +1,191 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef BUGSPRAY_BENCHMARK_HPP
+#define BUGSPRAY_BENCHMARK_HPP
+
+#include "bugspray/benchmark/benchmark_analysis.hpp"
+#include "bugspray/benchmark/benchmark_baseline.hpp"
+#include "bugspray/benchmark/benchmark_config.hpp"
+#include "bugspray/benchmark/benchmark_result.hpp"
+#include "bugspray/benchmark/chronometer.hpp"
+#include "bugspray/test_evaluation/test_run_data.hpp"
+#include "bugspray/utility/source_location.hpp"
+#include "bugspray/utility/string.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <concepts>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <cstddef>
+
+/*
+ * benchmark is the object behind BENCHMARK and BENCHMARK_ADVANCED. Assigning the benchmark body runs it:
+ *   1. The iteration count is estimated by doubling the number of iterations until a run takes at least the warm-up
+ *      time. This also serves as warm-up for the code under test.
+ *   2. The iteration count per sample is chosen so that a sample takes at least 1000 ticks of the clock.
+ *   3. The configured number of samples is collected and analysed (see benchmark_analysis.hpp).
+ *   4. If a baseline is configured, the samples are compared to it. The comparison is logged as an assertion, which
+ *      fails on a regression.
+ * During constant evaluation, and when benchmarks are skipped, the benchmark converts to false and its body is never
+ * run.
+ */
+
+namespace bs
+{
+namespace detail
+{
+inline constexpr double benchmark_minimum_ticks = 1000.;
+
+// Mean duration between two distinct readings of chronometer::clock, in nanoseconds. Measured once and cached.
+[[nodiscard]] auto clock_resolution() -> double;
+} // namespace detail
+
+struct benchmark
+{
+    // text is the macro invocation, used as assertion text when comparing to a baseline. It must outlive the reporter.
+    constexpr benchmark(test_run_data& data, std::string_view name, std::string_view text, source_location sloc)
+        : m_data(data)
+        , m_name(name)
+        , m_text(text)
+        , m_sloc(sloc)
+    {
+    }
+
+    constexpr explicit operator bool() const noexcept
+    {
+        if (std::is_constant_evaluated())
+            return false;
+        return !g_benchmark_config.skip;
+    }
+
+    template<typename Fun>
+    auto operator=(Fun fun) -> benchmark&
+    {
+        run(fun);
+        return *this;
+    }
+
+  private:
+    using nanoseconds = std::chrono::duration<double, std::nano>;
+
+    template<typename Fun>
+    static auto measure(Fun& fun, std::size_t iterations) -> nanoseconds
+    {
+        chronometer::clock::duration elapsed{};
+        chronometer                  meter{iterations, elapsed};
+        if constexpr (std::invocable<Fun&, chronometer>)
+            fun(meter);
+        else
+            meter.measure(fun);
+        return elapsed;
+    }
+
+    template<typename Fun>
+    void run(Fun& fun)
+    {
+        auto const& cfg = g_benchmark_config;
+
+        auto const resolution = detail::clock_resolution();
+        auto const min_time   = nanoseconds{resolution * detail::benchmark_minimum_ticks};
+        auto const run_time   = std::max(min_time, nanoseconds{cfg.warmup_time});
+
+        std::size_t estimation_iterations = 1;
+        nanoseconds elapsed               = measure(fun, estimation_iterations);
+        while (elapsed < run_time && estimation_iterations < (std::size_t{1} << 30))
+        {
+            estimation_iterations *= 2;
+            elapsed = measure(fun, estimation_iterations);
+        }
+
+        auto const per_iteration = elapsed / static_cast<double>(estimation_iterations);
+        auto const iterations    = std::max<std::size_t>(
+            1,
+            static_cast<std::size_t>(std::ceil(min_time / std::max(per_iteration, nanoseconds{resolution}))));
+        auto const samples = std::max<std::size_t>(1, cfg.samples);
+
+        std::vector<double> sample_values(samples);
+        for (auto& s : sample_values)
+            s = measure(fun, iterations).count() / static_cast<double>(iterations);
+
+        auto const analysis = analyse_samples(sample_values, cfg.resamples, cfg.confidence_interval, cfg.seed);
+
+        std::vector<std::string> sections;
+        for (auto&& section : m_data.current())
+            sections.emplace_back(std::string_view{section});
+
+        std::optional<benchmark_comparison> comparison;
+        auto const* entry = cfg.baseline ? cfg.baseline->find(m_data.test_case_name(), sections, m_name) : nullptr;
+        if (entry)
+            comparison = compare_to_baseline(*entry,
+                                             sample_values,
+                                             analysis.mean.point,
+                                             cfg.regression_threshold,
+                                             1. - cfg.confidence_interval);
+        if (cfg.recording)
+            cfg.recording->record({
+                .test_case          = std::string{m_data.test_case_name()},
+                .sections           = std::move(sections),
+                .name               = std::string{m_name},
+                .mean               = analysis.mean.point,
+                .standard_deviation = analysis.standard_deviation.point,
+                .samples            = sample_values,
+            });
+
+        m_data.log_benchmark(benchmark_result{
+            .name               = std::string_view{m_name},
+            .samples            = samples,
+            .resamples          = cfg.resamples,
+            .iterations         = iterations,
+            .clock_resolution   = resolution,
+            .estimated_duration = per_iteration.count() * static_cast<double>(iterations * samples),
+            .mean               = analysis.mean,
+            .standard_deviation = analysis.standard_deviation,
+            .outliers           = analysis.outliers,
+            .outlier_variance   = analysis.outlier_variance,
+            .comparison         = comparison,
+        });
+
+        if (comparison)
+        {
+            m_data.log_assertion(m_text, m_sloc, describe(*comparison), !comparison->regression);
+            if (comparison->regression)
+                m_data.mark_failed();
+        }
+    }
+
+    test_run_data&   m_data;
+    bs::string       m_name;
+    std::string_view m_text;
+    source_location  m_sloc;
+};
+} // namespace bs
+
+#endif // BUGSPRAY_BENCHMARK_HPP
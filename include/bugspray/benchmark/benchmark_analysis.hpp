@@ -0,0 +1,69 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef BUGSPRAY_BENCHMARK_ANALYSIS_HPP
+#define BUGSPRAY_BENCHMARK_ANALYSIS_HPP
+
+#include "bugspray/benchmark/benchmark_result.hpp"
+
+#include <span>
+
+#include <cstddef>
+#include <cstdint>
+
+/*
+ * Statistical analysis of benchmark samples, following Catch2 (and criterion before it): mean and standard deviation
+ * are estimated with bias-corrected and accelerated bootstrap confidence intervals, outliers are classified with
+ * Tukey's fences and their influence on the variance is estimated.
+ * mann_whitney_u tests whether one set of samples tends to be larger than another, without assuming a distribution.
+ */
+
+namespace bs
+{
+struct sample_analysis
+{
+    benchmark_estimate     mean;
+    benchmark_estimate     standard_deviation;
+    outlier_classification outliers;
+    double                 outlier_variance = 0.;
+};
+
+struct rank_test_result
+{
+    double u       = 0.;
+    double p_value = 1.; // One-sided: the probability of a U this large if samples were not larger than baseline
+};
+
+[[nodiscard]] auto classify_outliers(std::span<double const> samples) -> outlier_classification;
+
+[[nodiscard]] auto analyse_samples(std::span<double const> samples,
+                                   std::size_t             resamples,
+                                   double                  confidence_interval,
+                                   std::uint64_t           seed) -> sample_analysis;
+
+[[nodiscard]] auto mann_whitney_u(std::span<double const> baseline, std::span<double const> samples)
+    -> rank_test_result;
+} // namespace bs
+
+#endif // BUGSPRAY_BENCHMARK_ANALYSIS_HPP
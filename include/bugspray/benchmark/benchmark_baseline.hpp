@@ -0,0 +1,88 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef BUGSPRAY_BENCHMARK_BASELINE_HPP
+#define BUGSPRAY_BENCHMARK_BASELINE_HPP
+
+#include "bugspray/benchmark/benchmark_result.hpp"
+
+#include <istream>
+#include <optional>
+#include <ostream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/*
+ * benchmark_baseline stores the results of earlier benchmark runs, keyed by test case, section path and benchmark
+ * name. It is read from and written to a JSON file:
+ *   {"benchmarks": [{"test_case": "...", "sections": ["...", ...], "name": "...", "mean": 1.5,
+ *                    "standard_deviation": 0.1, "samples": [1.4, 1.6, ...]}, ...]}
+ * All durations are in nanoseconds per iteration. The raw samples are kept so that later runs can be compared with
+ * a rank test instead of only looking at the means.
+ */
+
+namespace bs
+{
+struct benchmark_baseline_entry
+{
+    std::string              test_case;
+    std::vector<std::string> sections;
+    std::string              name;
+    double                   mean               = 0.;
+    double                   standard_deviation = 0.;
+    std::vector<double>      samples;
+};
+
+struct benchmark_baseline
+{
+    [[nodiscard]] static auto read(std::istream& stream) -> std::optional<benchmark_baseline>;
+    void                      write(std::ostream& stream) const;
+
+    [[nodiscard]] auto find(std::string_view              test_case,
+                            std::span<std::string const> sections,
+                            std::string_view              name) const -> benchmark_baseline_entry const*;
+    [[nodiscard]] auto entries() const noexcept -> std::span<benchmark_baseline_entry const> { return m_entries; }
+
+    // Adds an entry, replacing an existing one of the same test case, sections and name
+    void record(benchmark_baseline_entry entry);
+
+  private:
+    std::vector<benchmark_baseline_entry> m_entries;
+};
+
+// Compares samples to a baseline entry. A regression requires the samples to be significantly slower, and the mean
+// to have increased by more than threshold, relative to the baseline mean.
+[[nodiscard]] auto compare_to_baseline(benchmark_baseline_entry const& baseline,
+                                       std::span<double const>         samples,
+                                       double                          mean,
+                                       double                          threshold,
+                                       double                          significance) -> benchmark_comparison;
+
+// Human readable summary of a comparison, e.g. "+12.3% relative to baseline (p = 0.001, threshold 5%)"
+[[nodiscard]] auto describe(benchmark_comparison const& comparison) -> std::string;
+} // namespace bs
+
+#endif // BUGSPRAY_BENCHMARK_BASELINE_HPP
@@ -0,0 +1,60 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef BUGSPRAY_BENCHMARK_CONFIG_HPP
+#define BUGSPRAY_BENCHMARK_CONFIG_HPP
+
+#include <chrono>
+
+#include <cstddef>
+#include <cstdint>
+
+/*
+ * Runtime configuration of benchmarks, set up by the test runner from the command line.
+ * If baseline is set, benchmarks found in it are compared to it, and fail their test case on a significant slowdown
+ * of more than regression_threshold. If recording is set, all benchmark results are stored in it.
+ */
+
+namespace bs
+{
+struct benchmark_baseline;
+
+struct benchmark_config
+{
+    std::size_t               samples             = 100;
+    std::size_t               resamples           = 100'000;
+    double                    confidence_interval = 0.95;
+    std::chrono::milliseconds warmup_time{100};
+    std::uint64_t             seed = 0;
+    bool                      skip = false;
+
+    benchmark_baseline const* baseline             = nullptr;
+    benchmark_baseline*       recording            = nullptr;
+    double                    regression_threshold = 0.05;
+};
+
+inline benchmark_config g_benchmark_config;
+} // namespace bs
+
+#endif // BUGSPRAY_BENCHMARK_CONFIG_HPP
@@ -0,0 +1,91 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef BUGSPRAY_BENCHMARK_RESULT_HPP
+#define BUGSPRAY_BENCHMARK_RESULT_HPP
+
+#include <optional>
+#include <string_view>
+
+#include <cstddef>
+
+/*
+ * The outcome of a benchmark as handed to reporters. All durations are given in nanoseconds per iteration.
+ */
+
+namespace bs
+{
+struct benchmark_estimate
+{
+    double point               = 0.;
+    double lower_bound         = 0.;
+    double upper_bound         = 0.;
+    double confidence_interval = 0.;
+};
+
+struct outlier_classification
+{
+    std::size_t samples_seen = 0;
+    std::size_t low_severe   = 0;
+    std::size_t low_mild     = 0;
+    std::size_t high_mild    = 0;
+    std::size_t high_severe  = 0;
+
+    [[nodiscard]] constexpr auto total() const noexcept -> std::size_t
+    {
+        return low_severe + low_mild + high_mild + high_severe;
+    }
+};
+
+// How a benchmark compares to its stored baseline. The p-value is that of a one-sided Mann-Whitney U test for the
+// samples being slower than those of the baseline.
+struct benchmark_comparison
+{
+    double baseline_mean = 0.;
+    double change        = 0.; // Relative change of the mean, e.g. 0.1 for 10% slower
+    double p_value       = 1.;
+    double threshold     = 0.;
+    bool   regression    = false;
+};
+
+struct benchmark_result
+{
+    std::string_view name;
+
+    std::size_t samples            = 0;
+    std::size_t resamples          = 0;
+    std::size_t iterations         = 0;
+    double      clock_resolution   = 0.;
+    double      estimated_duration = 0.;
+
+    benchmark_estimate     mean;
+    benchmark_estimate     standard_deviation;
+    outlier_classification outliers;
+    double                 outlier_variance = 0.;
+
+    std::optional<benchmark_comparison> comparison;
+};
+} // namespace bs
+
+#endif // BUGSPRAY_BENCHMARK_RESULT_HPP
@@ -0,0 +1,100 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef BUGSPRAY_CHRONOMETER_HPP
+#define BUGSPRAY_CHRONOMETER_HPP
+
+#include <chrono>
+#include <concepts>
+#include <type_traits>
+
+#include <cstddef>
+
+/*
+ * chronometer is handed to BENCHMARK_ADVANCED bodies. Setup can be done before calling measure(), which times the
+ * given function for runs() iterations. The function may optionally take the iteration index as int. Return values
+ * are kept alive, so that the optimizer cannot remove the computation. Like in Catch2, the chronometer is taken by
+ * value, so copies report to the same measurement.
+ */
+
+namespace bs
+{
+template<typename T>
+inline void keep_value(T const& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "g"(&value) : "memory");
+#else
+    static void const* volatile sink;
+    sink = &value;
+#endif
+}
+
+struct chronometer
+{
+    using clock = std::chrono::steady_clock;
+
+    chronometer(std::size_t runs, clock::duration& elapsed) noexcept
+        : m_runs(runs)
+        , m_elapsed(&elapsed)
+    {
+    }
+
+    template<typename Fun>
+    void measure(Fun&& fun)
+    {
+        auto const start = clock::now();
+        for (std::size_t i = 0; i < m_runs; ++i)
+            invoke(fun, i);
+        *m_elapsed = clock::now() - start;
+    }
+
+    [[nodiscard]] auto runs() const noexcept -> std::size_t { return m_runs; }
+
+  private:
+    template<typename Fun>
+    static void invoke(Fun& fun, std::size_t i)
+    {
+        if constexpr (std::invocable<Fun&, int>)
+        {
+            if constexpr (std::is_void_v<std::invoke_result_t<Fun&, int>>)
+                fun(static_cast<int>(i));
+            else
+                keep_value(fun(static_cast<int>(i)));
+        }
+        else
+        {
+            if constexpr (std::is_void_v<std::invoke_result_t<Fun&>>)
+                fun();
+            else
+                keep_value(fun());
+        }
+    }
+
+    std::size_t      m_runs;
+    clock::duration* m_elapsed;
+};
+} // namespace bs
+
+#endif // BUGSPRAY_CHRONOMETER_HPP
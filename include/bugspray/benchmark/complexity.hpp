@@ -0,0 +1,262 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef BUGSPRAY_COMPLEXITY_HPP
+#define BUGSPRAY_COMPLEXITY_HPP
+
+#include "bugspray/benchmark/benchmark.hpp"
+#include "bugspray/benchmark/chronometer.hpp"
+#include "bugspray/to_string/to_string_integral.hpp"
+#include "bugspray/utility/string.hpp"
+#include "bugspray/utility/vector.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <concepts>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+#include <cassert>
+#include <cstddef>
+
+/*
+ * Empirical complexity checks. measure_complexity calls a function with input sizes n = 16, 32, 64, ... up to a
+ * maximum and records a cost for each:
+ *   - If the function returns an arithmetic value, that value is the cost, e.g. a count of comparisons. This works
+ *     during constant evaluation.
+ *   - Otherwise, the cost is the time per call. Timing is skipped during constant evaluation.
+ * fit_complexity then fits cost = c * f(n) by least squares for every complexity class f. Operation counts are exact,
+ * so absolute errors are minimized and the largest sizes dominate the fit. Timing noise grows with the time measured,
+ * so for timings relative errors are minimized instead, which keeps a single noisy measurement of a large size from
+ * deciding the fit. Going from the lowest class up, a class is picked if its residual is less than a quarter of that
+ * of the class picked so far. Timings of linear code tend to grow a little faster than linear due to caches; the
+ * margin keeps them from being classified as O(n log n), while a quadratic still stands out by orders of magnitude.
+ * Sizes are powers of two, so log(n) is exact and fitting does not need <cmath>. Fewer than three sizes cannot tell
+ * the classes apart, so measure_complexity requires a maximum of at least 64.
+ */
+
+namespace bs
+{
+enum class complexity
+{
+    constant,
+    logarithmic,
+    linear,
+    linearithmic,
+    quadratic,
+};
+
+[[nodiscard]] constexpr auto complexity_name(complexity c) noexcept -> std::string_view
+{
+    switch (c)
+    {
+        using enum complexity;
+    case constant:
+        return "O(1)";
+    case logarithmic:
+        return "O(log n)";
+    case linear:
+        return "O(n)";
+    case linearithmic:
+        return "O(n log n)";
+    case quadratic:
+        return "O(n^2)";
+    }
+    return "";
+}
+
+enum class complexity_errors
+{
+    absolute,
+    relative,
+};
+
+namespace detail
+{
+inline constexpr std::size_t complexity_min_size          = 16;
+inline constexpr std::size_t complexity_min_sizes          = 3;
+inline constexpr std::size_t complexity_timing_repetitions = 5;
+inline constexpr double      complexity_fit_margin         = 0.25;
+
+[[nodiscard]] constexpr auto complexity_function(complexity c, std::size_t n) noexcept -> double
+{
+    auto const x  = static_cast<double>(n);
+    auto const lg = static_cast<double>(std::bit_width(n) - 1);
+    switch (c)
+    {
+        using enum complexity;
+    case constant:
+        return 1.;
+    case logarithmic:
+        return lg;
+    case linear:
+        return x;
+    case linearithmic:
+        return x * lg;
+    case quadratic:
+        return x * x;
+    }
+    return 0.;
+}
+
+// The fastest of several timings of fun(n), each long enough to be well above the clock resolution
+template<typename Fun>
+auto time_per_call(Fun& fun, std::size_t n) -> double
+{
+    using nanoseconds = std::chrono::duration<double, std::nano>;
+
+    auto const min_time = nanoseconds{clock_resolution() * benchmark_minimum_ticks};
+    auto const run      = [&](std::size_t iterations) -> nanoseconds
+    {
+        auto const start = chronometer::clock::now();
+        for (std::size_t i = 0; i < iterations; ++i)
+        {
+            if constexpr (std::is_void_v<std::invoke_result_t<Fun&, std::size_t>>)
+                fun(n);
+            else
+                keep_value(fun(n));
+        }
+        return chronometer::clock::now() - start;
+    };
+
+    std::size_t iterations = 1;
+    auto        elapsed    = run(iterations);
+    while (elapsed < min_time)
+    {
+        iterations *= 2;
+        elapsed = run(iterations);
+    }
+
+    auto best = elapsed.count() / static_cast<double>(iterations);
+    for (std::size_t i = 1; i < complexity_timing_repetitions; ++i)
+        best = std::min(best, run(iterations).count() / static_cast<double>(iterations));
+    return best;
+}
+} // namespace detail
+
+// sizes must be powers of two
+[[nodiscard]] constexpr auto fit_complexity(std::span<std::size_t const> sizes,
+                                            std::span<double const>      costs,
+                                            complexity_errors            errors = complexity_errors::absolute)
+    -> complexity
+{
+    assert(sizes.size() == costs.size());
+
+    // Relative errors need positive costs
+    bool const relative =
+        errors == complexity_errors::relative && std::ranges::all_of(costs, [](double c) { return c > 0.; });
+    auto const weight = [&](std::size_t i) { return relative ? 1. / (costs[i] * costs[i]) : 1.; };
+
+    auto   best          = complexity::constant;
+    double best_residual = 0.;
+    for (auto c : {complexity::constant,
+                   complexity::logarithmic,
+                   complexity::linear,
+                   complexity::linearithmic,
+                   complexity::quadratic})
+    {
+        double sum_cost_fn = 0.;
+        double sum_fn_fn   = 0.;
+        for (std::size_t i = 0; i < sizes.size(); ++i)
+        {
+            auto const fn = detail::complexity_function(c, sizes[i]);
+            sum_cost_fn += weight(i) * costs[i] * fn;
+            sum_fn_fn += weight(i) * fn * fn;
+        }
+        auto const coefficient = sum_fn_fn > 0. ? sum_cost_fn / sum_fn_fn : 0.;
+
+        double residual = 0.;
+        for (std::size_t i = 0; i < sizes.size(); ++i)
+        {
+            auto const error = costs[i] - coefficient * detail::complexity_function(c, sizes[i]);
+            residual += weight(i) * error * error;
+        }
+
+        if (c == complexity::constant || residual < detail::complexity_fit_margin * best_residual)
+        {
+            best          = c;
+            best_residual = residual;
+        }
+    }
+    return best;
+}
+
+// The smallest max_size that measure_complexity accepts
+inline constexpr std::size_t complexity_min_max_size = detail::complexity_min_size
+                                                       << (detail::complexity_min_sizes - 1);
+
+// Returns std::nullopt if max_size is less than complexity_min_max_size, or if fun is timed and constant evaluated
+template<typename Fun>
+    requires std::invocable<Fun&, std::size_t>
+constexpr auto measure_complexity(std::size_t max_size, Fun&& fun) -> std::optional<complexity>
+{
+    using result_type = std::invoke_result_t<Fun&, std::size_t>;
+    constexpr bool counts_operations =
+        std::is_arithmetic_v<result_type> && !std::is_same_v<std::remove_cv_t<result_type>, bool>;
+
+    if (max_size < complexity_min_max_size)
+        return std::nullopt;
+    if constexpr (!counts_operations)
+    {
+        if (std::is_constant_evaluated())
+            return std::nullopt;
+    }
+
+    bs::vector<std::size_t> sizes;
+    bs::vector<double>      costs;
+    for (std::size_t n = detail::complexity_min_size; n <= max_size; n *= 2)
+    {
+        sizes.push_back(n);
+        if constexpr (counts_operations)
+            costs.push_back(static_cast<double>(fun(n)));
+        else
+            costs.push_back(detail::time_per_call(fun, n));
+    }
+    return fit_complexity(sizes, costs, counts_operations ? complexity_errors::absolute : complexity_errors::relative);
+}
+
+// Expansion of a complexity assertion whose max_size is too small, e.g. "not enough sizes: max size 32 < 64"
+[[nodiscard]] constexpr auto describe_too_few_sizes(std::size_t max_size) -> bs::string
+{
+    bs::string result{"not enough sizes: max size "};
+    result += to_string(max_size);
+    result += " < ";
+    result += to_string(complexity_min_max_size);
+    return result;
+}
+
+// Expansion of a complexity assertion, e.g. "O(n^2) <= O(n)"
+[[nodiscard]] constexpr auto describe_complexity(complexity fitted, complexity expected) -> bs::string
+{
+    bs::string result{complexity_name(fitted)};
+    result += " <= ";
+    result += bs::string{complexity_name(expected)};
+    return result;
+}
+} // namespace bs
+
+#endif // BUGSPRAY_COMPLEXITY_HPP
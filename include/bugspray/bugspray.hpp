@@ -27,7 +27,10 @@
 
 #include "bugspray/macro_interface/asserting_function_macros.hpp"
 #include "bugspray/macro_interface/assertion_macros.hpp"
+#include "bugspray/macro_interface/benchmark_macros.hpp"
 #include "bugspray/macro_interface/capture_macro.hpp"
+#include "bugspray/macro_interface/complexity_macros.hpp"
+#include "bugspray/macro_interface/metric_macros.hpp"
 #include "bugspray/macro_interface/section_macro.hpp"
 #include "bugspray/macro_interface/test_case_macros.hpp"
 #include "bugspray/utility/static_for.hpp"
@@ -47,6 +47,11 @@ constexpr auto reporter_parser = [](std::string_view arg, config::reporter_enum&
         out = config::reporter_enum::xml;
         return true;
     }
+    if (arg == "trace")
+    {
+        out = config::reporter_enum::trace;
+        return true;
+    }
     return false;
 };
 constexpr auto order_parser = [](std::string_view arg, config::order_enum& out)
@@ -90,12 +95,12 @@ constexpr parameter<decltype(parameter_names{"--version"}),
 constexpr parameter<decltype(parameter_names{"-r", "--reporter"}),
                     decltype(argument_destination{&config::reporter}),
                     decltype(reporter_parser),
-                    structural_string{"select reporter from [console, xml]"}.size() + 1>
+                    structural_string{"select reporter from [console, xml, trace]"}.size() + 1>
     reporter_param{
         .names       = parameter_names{"-r", "--reporter"},
         .destination = argument_destination{&config::reporter},
         .parser      = reporter_parser,
-        .help        = structural_string{"select reporter from [console, xml]"},
+        .help        = structural_string{"select reporter from [console, xml, trace]"},
     };
 constexpr parameter<decltype(parameter_names{"-o", "--out"}),
                     decltype(argument_destination{&config::output}),
@@ -134,6 +139,123 @@ constexpr parameter<decltype(parameter_names{"--rng-seed"}),
         .destination = argument_destination{&config::seed},
         .help        = structural_string{"specify the seed for the random number generator used by bugspray"},
     };
+constexpr parameter<decltype(parameter_names{"--profile"}),
+                    decltype(argument_destination{&config::profile_output}),
+                    parsers::arg_parser,
+                    structural_string{"sample the call stack and write folded stacks to a file"}.size() + 1>
+    profile_param{
+        .names       = parameter_names{"--profile"},
+        .destination = argument_destination{&config::profile_output},
+        .help        = structural_string{"sample the call stack and write folded stacks to a file"},
+    };
+constexpr parameter<decltype(parameter_names{"--measure-overhead"}),
+                    decltype(argument_destination{&config::measure_overhead}),
+                    parsers::arg_parser,
+                    structural_string{"report time spent in bugspray itself versus test code"}.size() + 1>
+    measure_overhead_param{
+        .names       = parameter_names{"--measure-overhead"},
+        .destination = argument_destination{&config::measure_overhead},
+        .help        = structural_string{"report time spent in bugspray itself versus test code"},
+    };
+constexpr parameter<decltype(parameter_names{"--section-waste"}),
+                    decltype(argument_destination{&config::section_waste}),
+                    parsers::arg_parser,
+                    structural_string{"report time spent re-running code shared between sections"}.size() + 1>
+    section_waste_param{
+        .names       = parameter_names{"--section-waste"},
+        .destination = argument_destination{&config::section_waste},
+        .help        = structural_string{"report time spent re-running code shared between sections"},
+    };
+constexpr parameter<decltype(parameter_names{"--benchmark-samples"}),
+                    decltype(argument_destination{&config::benchmark_samples}),
+                    parsers::arg_parser,
+                    structural_string{"number of samples to collect per benchmark"}.size() + 1>
+    benchmark_samples_param{
+        .names       = parameter_names{"--benchmark-samples"},
+        .destination = argument_destination{&config::benchmark_samples},
+        .help        = structural_string{"number of samples to collect per benchmark"},
+    };
+constexpr parameter<decltype(parameter_names{"--benchmark-resamples"}),
+                    decltype(argument_destination{&config::benchmark_resamples}),
+                    parsers::arg_parser,
+                    structural_string{"number of bootstrap resamples for benchmark analysis"}.size() + 1>
+    benchmark_resamples_param{
+        .names       = parameter_names{"--benchmark-resamples"},
+        .destination = argument_destination{&config::benchmark_resamples},
+        .help        = structural_string{"number of bootstrap resamples for benchmark analysis"},
+    };
+constexpr parameter<decltype(parameter_names{"--benchmark-warmup-time"}),
+                    decltype(argument_destination{&config::benchmark_warmup_time}),
+                    parsers::arg_parser,
+                    structural_string{"minimum warm-up time per benchmark in milliseconds"}.size() + 1>
+    benchmark_warmup_time_param{
+        .names       = parameter_names{"--benchmark-warmup-time"},
+        .destination = argument_destination{&config::benchmark_warmup_time},
+        .help        = structural_string{"minimum warm-up time per benchmark in milliseconds"},
+    };
+constexpr parameter<decltype(parameter_names{"--skip-benchmarks"}),
+                    decltype(argument_destination{&config::skip_benchmarks}),
+                    parsers::arg_parser,
+                    structural_string{"do not run benchmarks"}.size() + 1>
+    skip_benchmarks_param{
+        .names       = parameter_names{"--skip-benchmarks"},
+        .destination = argument_destination{&config::skip_benchmarks},
+        .help        = structural_string{"do not run benchmarks"},
+    };
+constexpr parameter<decltype(parameter_names{"--benchmark-baseline"}),
+                    decltype(argument_destination{&config::benchmark_baseline}),
+                    parsers::arg_parser,
+                    structural_string{"compare benchmarks to the results stored in a file"}.size() + 1>
+    benchmark_baseline_param{
+        .names       = parameter_names{"--benchmark-baseline"},
+        .destination = argument_destination{&config::benchmark_baseline},
+        .help        = structural_string{"compare benchmarks to the results stored in a file"},
+    };
+constexpr parameter<decltype(parameter_names{"--benchmark-save"}),
+                    decltype(argument_destination{&config::benchmark_save}),
+                    parsers::arg_parser,
+                    structural_string{"store benchmark results in a file"}.size() + 1>
+    benchmark_save_param{
+        .names       = parameter_names{"--benchmark-save"},
+        .destination = argument_destination{&config::benchmark_save},
+        .help        = structural_string{"store benchmark results in a file"},
+    };
+constexpr parameter<decltype(parameter_names{"--benchmark-threshold"}),
+                    decltype(argument_destination{&config::benchmark_threshold}),
+                    parsers::arg_parser,
+                    structural_string{"slowdown in percent at which a benchmark fails"}.size() + 1>
+    benchmark_threshold_param{
+        .names       = parameter_names{"--benchmark-threshold"},
+        .destination = argument_destination{&config::benchmark_threshold},
+        .help        = structural_string{"slowdown in percent at which a benchmark fails"},
+    };
+constexpr parameter<decltype(parameter_names{"--max-expansion-length"}),
+                    decltype(argument_destination{&config::max_expansion_length}),
+                    parsers::arg_parser,
+                    structural_string{"maximum length of a stringified value in a report"}.size() + 1>
+    max_expansion_length_param{
+        .names       = parameter_names{"--max-expansion-length"},
+        .destination = argument_destination{&config::max_expansion_length},
+        .help        = structural_string{"maximum length of a stringified value in a report"},
+    };
+constexpr parameter<decltype(parameter_names{"--max-container-elements"}),
+                    decltype(argument_destination{&config::max_container_elements}),
+                    parsers::arg_parser,
+                    structural_string{"maximum number of container elements to stringify"}.size() + 1>
+    max_container_elements_param{
+        .names       = parameter_names{"--max-container-elements"},
+        .destination = argument_destination{&config::max_container_elements},
+        .help        = structural_string{"maximum number of container elements to stringify"},
+    };
+constexpr parameter<decltype(parameter_names{"--max-string-length"}),
+                    decltype(argument_destination{&config::max_string_length}),
+                    parsers::arg_parser,
+                    structural_string{"maximum number of characters of a string to stringify"}.size() + 1>
+    max_string_length_param{
+        .names       = parameter_names{"--max-string-length"},
+        .destination = argument_destination{&config::max_string_length},
+        .help        = structural_string{"maximum number of characters of a string to stringify"},
+    };
 constexpr parameter<decltype(parameter_names{"test-spec"}),
                     decltype(argument_destination{&config::test_spec}),
                     parsers::arg_parser,
@@ -152,6 +274,19 @@ using argparser = argument_parser<detail::help_param,
                                   detail::durations_param,
                                   detail::order_param,
                                   detail::order_rng_seed,
+                                  detail::profile_param,
+                                  detail::measure_overhead_param,
+                                  detail::section_waste_param,
+                                  detail::benchmark_samples_param,
+                                  detail::benchmark_resamples_param,
+                                  detail::benchmark_warmup_time_param,
+                                  detail::skip_benchmarks_param,
+                                  detail::benchmark_baseline_param,
+                                  detail::benchmark_save_param,
+                                  detail::benchmark_threshold_param,
+                                  detail::max_expansion_length_param,
+                                  detail::max_container_elements_param,
+                                  detail::max_string_length_param,
                                   detail::test_spec_param>;
 } // namespace bs
 
@@ -41,6 +41,7 @@ struct config
     {
         console,
         xml,
+        trace,
     } reporter = reporter_enum::console;
     std::string_view output;
 
@@ -54,6 +55,22 @@ struct config
     bool        report_durations = false;
     std::size_t seed             = std::random_device{}();
 
+    std::string_view profile_output;
+    bool             measure_overhead = false;
+    bool             section_waste    = false;
+
+    std::size_t      benchmark_samples     = 100;
+    std::size_t      benchmark_resamples   = 100'000;
+    std::size_t      benchmark_warmup_time = 100;
+    bool             skip_benchmarks       = false;
+    std::string_view benchmark_baseline;
+    std::string_view benchmark_save;
+    std::size_t      benchmark_threshold = 5;
+
+    std::size_t max_expansion_length   = 100'000;
+    std::size_t max_container_elements = 10'000;
+    std::size_t max_string_length      = 10'000;
+
     std::string_view test_spec;
 };
 } // namespace bs
@@ -26,7 +26,7 @@
 #define BUGSPRAY_ASSERTION_MACROS_HPP
 
 #include "bugspray/test_evaluation/decomposition/decomposer.hpp"
-#include "bugspray/test_evaluation/decomposition/decomposition_result.hpp"
+#include "bugspray/test_evaluation/overhead_accounting.hpp"
 #include "bugspray/utility/macros.hpp"
 #include "bugspray/utility/source_location.hpp"
 
@@ -51,23 +51,32 @@
 #define BUGSPRAY_ASSERTION_IMPL2(type, text, decomp_str, result)                                                       \
     do                                                                                                                 \
     {                                                                                                                  \
-        bugspray_data.log_assertion(text, BUGSPRAY_THIS_LOCATION(), decomp_str, result);                               \
-        if (!result)                                                                                                   \
+        constexpr bool aborting        = std::string_view{#type} == "REQUIRE";                                         \
+        bool const     bugspray_passed = result;                                                                       \
+        if (bugspray_passed && !bugspray_data.logs_passed_assertions()) [[likely]]                                     \
+            bugspray_data.count_passed_assertion();                                                                    \
+        else                                                                                                           \
         {                                                                                                              \
-            constexpr bool aborting = std::string_view{#type} == "REQUIRE";                                            \
-            bugspray_data.mark_failed();                                                                               \
+            ::bs::overhead_scope const bugspray_overhead_scope{::bs::overhead_category::assertions};                   \
+            bugspray_data.report_assertion(text, BUGSPRAY_THIS_LOCATION(), decomp_str, bugspray_passed, aborting);     \
             if constexpr (aborting)                                                                                    \
             {                                                                                                          \
-                bugspray_data.mark_aborted();                                                                          \
-                return;                                                                                                \
+                if (!bugspray_passed)                                                                                  \
+                    return;                                                                                            \
             }                                                                                                          \
         }                                                                                                              \
     } while (false)
 #define BUGSPRAY_ASSERTION_IMPL(type, text, ...)                                                                       \
     do                                                                                                                 \
     {                                                                                                                  \
-        ::bs::decomposition_result const decom = ::bs::decomposer{} % __VA_ARGS__;                                     \
-        BUGSPRAY_ASSERTION_IMPL2(type, text, decom.str(), decom.result());                                             \
+        constexpr bool aborting = std::string_view{#type} == "REQUIRE";                                                \
+        bool const     bugspray_passed =                                                                               \
+            bugspray_data.check_assertion(text, BUGSPRAY_THIS_LOCATION(), ::bs::decomposer{} % __VA_ARGS__, aborting); \
+        if constexpr (aborting)                                                                                        \
+        {                                                                                                              \
+            if (!bugspray_passed)                                                                                      \
+                return;                                                                                                \
+        }                                                                                                              \
     } while (false)
 #define BUGSPRAY_ASSERTION_IMPL_MAKE_TEXT(type, ...) #type "(" BUGSPRAY_STRINGIFY_EXPANSION(__VA_ARGS__) ")"
 
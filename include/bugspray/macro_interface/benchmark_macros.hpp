@@ -0,0 +1,60 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef BUGSPRAY_BENCHMARK_MACROS_HPP
+#define BUGSPRAY_BENCHMARK_MACROS_HPP
+
+#include "bugspray/benchmark/benchmark.hpp"
+#include "bugspray/utility/macros.hpp"
+#include "bugspray/utility/source_location.hpp"
+
+/*
+ * BUGSPRAY_BENCHMARK(<name>) { <body> }; benchmarks the following body, which is run as lambda capturing by reference.
+ * Arguments:
+ *   <name>: Name of the benchmark as string.
+ *
+ * BUGSPRAY_BENCHMARK_ADVANCED(<name>)(bs::chronometer meter) { <body> }; benchmarks with explicit control over what is
+ * measured. Setup code may run before calling meter.measure(<function>); only the function passed to measure is timed.
+ * Arguments:
+ *   <name>: Name of the benchmark as string.
+ *
+ * Benchmarks are never run during constant evaluation, or if benchmarks are skipped in the runtime configuration.
+ * If a baseline is configured, a benchmark slower than its baseline fails the test case.
+ */
+
+#define BUGSPRAY_BENCHMARK_IMPL(benchmark_id, type, name)                                                              \
+    if (::bs::benchmark benchmark_id{bugspray_data, name, #type "(" #name ")", BUGSPRAY_THIS_LOCATION()})              \
+    benchmark_id = [&]
+
+#define BUGSPRAY_BENCHMARK(name)                                                                                       \
+    BUGSPRAY_BENCHMARK_IMPL(BUGSPRAY_UNIQUE_IDENTIFIER(bugspray_benchmark), BENCHMARK, name)
+#define BUGSPRAY_BENCHMARK_ADVANCED(name)                                                                              \
+    BUGSPRAY_BENCHMARK_IMPL(BUGSPRAY_UNIQUE_IDENTIFIER(bugspray_benchmark), BENCHMARK_ADVANCED, name)
+
+#ifndef BUGSPRAY_NO_SHORT_MACROS
+#define BENCHMARK(...) BUGSPRAY_BENCHMARK(__VA_ARGS__)
+#define BENCHMARK_ADVANCED(...) BUGSPRAY_BENCHMARK_ADVANCED(__VA_ARGS__)
+#endif
+
+#endif // BUGSPRAY_BENCHMARK_MACROS_HPP
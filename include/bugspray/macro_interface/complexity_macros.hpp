@@ -0,0 +1,76 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef BUGSPRAY_COMPLEXITY_MACROS_HPP
+#define BUGSPRAY_COMPLEXITY_MACROS_HPP
+
+#include "bugspray/benchmark/complexity.hpp"
+#include "bugspray/macro_interface/assertion_macros.hpp"
+
+/*
+ * BUGSPRAY_CHECK_COMPLEXITY(<complexity>, <max size>, <function>): Fails and continues the test if the function scales
+ *                                                                  worse than the given complexity.
+ * BUGSPRAY_REQUIRE_COMPLEXITY(<complexity>, <max size>, <function>): Fails and aborts the test if the function scales
+ *                                                                    worse than the given complexity.
+ * Arguments:
+ *   <complexity>: One of [constant, logarithmic, linear, linearithmic, quadratic].
+ *   <max size>: The largest input size the function is called with. Fails the assertion if less than 64, since fewer
+ *               than three sizes cannot tell complexity classes apart.
+ *   <function>: Called with input sizes 16, 32, 64, ... up to max size. If it returns an arithmetic value, that is
+ *               taken as its cost, otherwise the function is timed. Timed functions are skipped during constant
+ *               evaluation.
+ */
+
+#define BUGSPRAY_COMPLEXITY_IMPL_TEXT(type, expected, max_size, ...)                                                   \
+    #type "_COMPLEXITY(" #expected ", " #max_size ", " #__VA_ARGS__ ")"
+#define BUGSPRAY_COMPLEXITY_IMPL(type, expected, max_size, ...)                                                        \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        ::std::size_t const bugspray_max_size = max_size;                                                              \
+        if (bugspray_max_size < ::bs::complexity_min_max_size)                                                         \
+        {                                                                                                              \
+            BUGSPRAY_ASSERTION_IMPL2(type,                                                                             \
+                                     BUGSPRAY_COMPLEXITY_IMPL_TEXT(type, expected, max_size, __VA_ARGS__),             \
+                                     ::bs::describe_too_few_sizes(bugspray_max_size),                                  \
+                                     false);                                                                           \
+        }                                                                                                              \
+        else if (auto const bugspray_fitted = ::bs::measure_complexity(bugspray_max_size, __VA_ARGS__))                \
+        {                                                                                                              \
+            bool const bugspray_complexity_ok = *bugspray_fitted <= ::bs::complexity::expected;                        \
+            BUGSPRAY_ASSERTION_IMPL2(type,                                                                             \
+                                     BUGSPRAY_COMPLEXITY_IMPL_TEXT(type, expected, max_size, __VA_ARGS__),             \
+                                     ::bs::describe_complexity(*bugspray_fitted, ::bs::complexity::expected),          \
+                                     bugspray_complexity_ok);                                                          \
+        }                                                                                                              \
+    } while (false)
+
+#define BUGSPRAY_CHECK_COMPLEXITY(...) BUGSPRAY_COMPLEXITY_IMPL(CHECK, __VA_ARGS__)
+#define BUGSPRAY_REQUIRE_COMPLEXITY(...) BUGSPRAY_COMPLEXITY_IMPL(REQUIRE, __VA_ARGS__)
+
+#ifndef BUGSPRAY_NO_SHORT_MACROS
+#define CHECK_COMPLEXITY(...) BUGSPRAY_CHECK_COMPLEXITY(__VA_ARGS__)
+#define REQUIRE_COMPLEXITY(...) BUGSPRAY_REQUIRE_COMPLEXITY(__VA_ARGS__)
+#endif
+
+#endif // BUGSPRAY_COMPLEXITY_MACROS_HPP
@@ -0,0 +1,76 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef BUGSPRAY_METRIC_MACROS_HPP
+#define BUGSPRAY_METRIC_MACROS_HPP
+
+#include "bugspray/macro_interface/assertion_macros.hpp"
+
+#include <type_traits>
+
+/*
+ * BUGSPRAY_REPORT_METRIC(<name>, <value>, <unit>, <OPT: threshold>) reports a measured value to the reporter, which
+ * stores it with the current section.
+ * Arguments:
+ *   <name>: Name of the metric as string.
+ *   <value>: The value, convertible to double. Only evaluated at runtime.
+ *   <unit>: Unit of the value as string, e.g. "MB/s".
+ *   <threshold>: Optional comparison the value must fulfill, e.g. ">= 100". Fails and continues the test otherwise.
+ *
+ * Metrics are not reported during constant evaluation, and neither value nor threshold are evaluated.
+ */
+
+namespace bs::detail
+{
+// Converts a metric to double without tripping -Wuseless-cast for doubles or -Wdouble-promotion for floats.
+template<typename T>
+constexpr auto metric_value(T const& value) -> double
+{
+    if constexpr (std::is_same_v<T, double>)
+        return value;
+    else
+        return static_cast<double>(value);
+}
+} // namespace bs::detail
+
+#define BUGSPRAY_REPORT_METRIC_IMPL(name, value, unit, ...)                                                            \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        if (!std::is_constant_evaluated())                                                                             \
+        {                                                                                                              \
+            double const bugspray_metric = ::bs::detail::metric_value(value);                                          \
+            bugspray_data.log_metric(name, bugspray_metric, unit);                                                     \
+            __VA_OPT__(BUGSPRAY_ASSERTION_IMPL(CHECK,                                                                  \
+                                               "REPORT_METRIC(" #name ", " #value ", " #unit ", " #__VA_ARGS__ ")",    \
+                                               bugspray_metric __VA_ARGS__);)                                          \
+        }                                                                                                              \
+    } while (false)
+
+#define BUGSPRAY_REPORT_METRIC(...) BUGSPRAY_REPORT_METRIC_IMPL(__VA_ARGS__)
+
+#ifndef BUGSPRAY_NO_SHORT_MACROS
+#define REPORT_METRIC(...) BUGSPRAY_REPORT_METRIC(__VA_ARGS__)
+#endif
+
+#endif // BUGSPRAY_METRIC_MACROS_HPP
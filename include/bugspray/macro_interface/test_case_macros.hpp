@@ -27,6 +27,7 @@
 
 #include "bugspray/test_evaluation/evaluate_test_case.hpp"
 #include "bugspray/test_evaluation/parse_tag_string.hpp"
+#include "bugspray/test_registration/evaluate_compiletime_tests.hpp"
 #include "bugspray/test_registration/test_case_registry.hpp"
 #include "bugspray/utility/macros.hpp"
 #include "bugspray/utility/source_location.hpp"
@@ -51,12 +52,24 @@
  * BUGSPRAY_EVAL_TEST_CASE(<name>) constexpr-evaluates a previously defined test case.
  * Arguments:
  *   <name>: Name of the test case as string.
+ *
+ * BUGSPRAY_EVAL_ALL_TEST_CASES() constexpr-evaluates all test cases defined so far in the translation unit, in a
+ * single constant evaluation. Failures of all test cases are reported together.
+ *
+ * BUGSPRAY_EVAL_TEST_CASE_STATS(<name>) constexpr-evaluates a previously defined test case, and yields the
+ * bs::evaluation_stats of the evaluation as constant expression.
+ * Arguments:
+ *   <name>: Name of the test case as string.
  */
 
 #ifndef BUGSPRAY_COMPILE_EVAL_TEST_SPEC
 #define BUGSPRAY_COMPILE_EVAL_TEST_SPEC ""
 #endif
 
+#ifndef BUGSPRAY_COMPILE_EVAL_MAX_FAILURES
+#define BUGSPRAY_COMPILE_EVAL_MAX_FAILURES 1
+#endif
+
 // clang-format off
 #define BUGSPRAY_REGISTER_TEST_CASE_IMPL_runtime(name, test_case_id)                                                   \
     static bool const BUGSPRAY_UNIQUE_IDENTIFIER(bugspray_registration)                                                \
@@ -66,17 +79,35 @@
     template<int Bogus>                                                                                                \
     struct bs::evaluate_compiletime_test<name, Bogus>                                                                  \
     {                                                                                                                  \
+        static constexpr bool selected = ::bs::test_case_filter(test_case_id, BUGSPRAY_COMPILE_EVAL_TEST_SPEC);        \
+                                                                                                                       \
         constexpr auto operator()() -> bool                                                                            \
         {                                                                                                              \
-            constexpr auto results = ::bs::evaluate_test_case_constexpr<Bogus>(test_case_id,                           \
-                                                                               BUGSPRAY_COMPILE_EVAL_TEST_SPEC);       \
-            if constexpr (!results.first)                                                                              \
+            if constexpr (selected)                                                                                    \
             {                                                                                                          \
-                constexpr auto m = ::bs::trim<results.second>();                                                       \
-                ::bs::compile_time_error<m>();                                                                         \
+                constexpr auto results                                                                                 \
+                    = ::bs::evaluate_test_case_constexpr<Bogus, BUGSPRAY_COMPILE_EVAL_MAX_FAILURES>(test_case_id);     \
+                if constexpr (!results.success)                                                                        \
+                    ::bs::report_compile_time_failures<results>();                                                     \
+                return results.success;                                                                                \
             }                                                                                                          \
-            return results.first;                                                                                      \
+            else                                                                                                       \
+                return true;                                                                                           \
+        }                                                                                                              \
+        constexpr auto stats() -> ::bs::evaluation_stats                                                               \
+        {                                                                                                              \
+            if constexpr (selected)                                                                                    \
+                return ::bs::evaluate_test_case_constexpr_stats<Bogus>(test_case_id);                                  \
+            else                                                                                                       \
+                return {};                                                                                             \
         }                                                                                                              \
+    };                                                                                                                 \
+    template<>                                                                                                         \
+    struct bs::detail::compiletime_test_entry<                                                                         \
+        ::bs::detail::translation_unit_tag,                                                                            \
+        ::bs::detail::next_compiletime_test_index<::bs::detail::translation_unit_tag, __COUNTER__>()>                  \
+    {                                                                                                                  \
+        static constexpr ::bs::test_case const* value = &test_case_id;                                                 \
     };
 // clang-format off
 #define BUGSPRAY_REGISTER_TEST_CASE_IMPL_both(name, test_case_id)                                                      \
@@ -121,11 +152,20 @@
                             BUGSPRAY_GET_3RD_ARG_OR(both, __VA_ARGS__))
 
 #define BUGSPRAY_EVAL_TEST_CASE(name) static_assert(::bs::evaluate_compiletime_test<name, 0>{}())
+#define BUGSPRAY_EVAL_ALL_TEST_CASES()                                                                                 \
+    static_assert(::bs::evaluate_compiletime_tests<                                                                    \
+                  ::bs::detail::translation_unit_tag,                                                                  \
+                  ::bs::detail::compiletime_test_count<::bs::detail::translation_unit_tag, __COUNTER__>(),             \
+                  BUGSPRAY_COMPILE_EVAL_TEST_SPEC,                                                                     \
+                  BUGSPRAY_COMPILE_EVAL_MAX_FAILURES>())
+#define BUGSPRAY_EVAL_TEST_CASE_STATS(name) (::bs::evaluate_compiletime_test<name, 0>{}.stats())
 
 #ifndef BUGSPRAY_NO_SHORT_MACROS
 #define REGISTER_TEST_CASE(...) BUGSPRAY_REGISTER_TEST_CASE(__VA_ARGS__)
 #define TEST_CASE(...) BUGSPRAY_TEST_CASE(__VA_ARGS__)
 #define EVAL_TEST_CASE(...) BUGSPRAY_EVAL_TEST_CASE(__VA_ARGS__)
+#define EVAL_ALL_TEST_CASES() BUGSPRAY_EVAL_ALL_TEST_CASES()
+#define EVAL_TEST_CASE_STATS(...) BUGSPRAY_EVAL_TEST_CASE_STATS(__VA_ARGS__)
 #endif
 
 #endif // BUGSPRAY_TEST_CASE_MACROS_HPP
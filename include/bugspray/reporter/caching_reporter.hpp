@@ -53,11 +53,24 @@ struct caching_reporter : reporter
         bs::vector<bs::string> messages;
         bool                   result;
     };
+    struct benchmark_data
+    {
+        bs::string       name;
+        benchmark_result result;
+    };
+    struct metric_data
+    {
+        bs::string name;
+        double     value;
+        bs::string unit;
+    };
     struct section_data;
     struct assertion_and_section_holder
     {
         bs::vector<assertion_data> assertions;
         bs::vector<section_data>   sections;
+        bs::vector<benchmark_data> benchmarks;
+        bs::vector<metric_data>    metrics;
     };
     struct section_data : assertion_and_section_holder
     {
@@ -100,6 +113,18 @@ struct caching_reporter : reporter
         m_test_cases.back().test_runs.back().target = target;
     }
 
+    constexpr void log_benchmark(benchmark_result const& result) noexcept override
+    {
+        auto* s = find_section(m_current_section);
+        s->benchmarks.push_back({bs::string{result.name}, result});
+    }
+
+    constexpr void log_metric(std::string_view name, double value, std::string_view unit) noexcept override
+    {
+        auto* s = find_section(m_current_section);
+        s->metrics.push_back({bs::string{name}, value, bs::string{unit}});
+    }
+
     constexpr void enter_section(std::string_view name, source_location sloc) noexcept override
     {
         create_section(name, sloc);
@@ -119,6 +144,10 @@ struct caching_reporter : reporter
         s->assertions.emplace_back(assertion, sloc, bs::string{expansion}, msgs, result);
     }
 
+    // Caches every passing assertion with its expansion, so it never receives bare counts
+    [[nodiscard]] constexpr auto needs_passed_assertions() const noexcept -> bool override { return true; }
+    constexpr void               log_passed_assertions(std::size_t /*count*/) noexcept override {}
+
     constexpr void finalize() noexcept override {}
 
     [[nodiscard]] constexpr auto cache() const noexcept -> bs::vector<test_case_data> const& { return m_test_cases; }
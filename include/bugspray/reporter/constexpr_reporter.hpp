@@ -27,22 +27,43 @@
 
 #include "bugspray/reporter/reporter.hpp"
 #include "bugspray/to_string/to_string_integral.hpp"
-#include "bugspray/utility/structural_string.hpp"
+#include "bugspray/utility/structural_buffer.hpp"
 
 #include <algorithm>
 #include <array>
+#include <optional>
 #include <ranges>
+#include <span>
+#include <string_view>
 
 /*
- * Reporter to be used for constexpr evaluation. It stores the first n messages of the first failed assertion in a
- * constexpr-friendly way. It assumes that compilation will abort after the first assertion failed, and therefore only
- * one assertion is ever logged as a failure.
+ * Reporter to be used for constexpr evaluation. It composes a message for each of the first max_failures failed
+ * assertions of every test case. Messages are composed in place in a structural_buffer, each cut to
+ * max_failure_message_length characters. result() turns them into a constexpr_evaluation_result, which can be passed
+ * on as NTTP.
  */
 
 namespace bs
 {
+inline constexpr std::size_t max_failure_message_length = 2048;
+
+template<std::size_t MaxFailures>
+struct constexpr_evaluation_result
+{
+    bool                                                                   success       = true;
+    std::size_t                                                            failure_count = 0;
+    std::array<structural_buffer<max_failure_message_length>, MaxFailures> failures{};
+};
+
 struct constexpr_reporter : reporter
 {
+    using failure_message = structural_buffer<max_failure_message_length>;
+
+    constexpr explicit constexpr_reporter(std::size_t max_failures = 1)
+        : m_max_failures(max_failures)
+    {
+    }
+
 #if defined(__GNUC__) && !defined(__clang__) && !defined(__INTEL_COMPILER)
     // TODO: check if gcc bug https://gcc.gnu.org/bugzilla/show_bug.cgi?id=93413 is fixed
     constexpr ~constexpr_reporter(){};
@@ -53,6 +74,7 @@ struct constexpr_reporter : reporter
                                    source_location sloc) noexcept override
     {
         m_sections.emplace_back(bs::string{name}, sloc);
+        m_test_case_failures = 0;
     }
     constexpr void leave_test_case() noexcept override { m_sections.pop_back(); }
 
@@ -61,6 +83,11 @@ struct constexpr_reporter : reporter
 
     constexpr void log_target(section_path const& target) noexcept override { m_target = target; }
 
+    constexpr void log_benchmark(benchmark_result const& /*result*/) noexcept override {}
+    constexpr void log_metric(std::string_view /*name*/, double /*value*/, std::string_view /*unit*/) noexcept override
+    {
+    }
+
     constexpr void enter_section(std::string_view name, source_location sloc) noexcept override
     {
         m_sections.emplace_back(bs::string{name}, sloc);
@@ -73,18 +100,35 @@ struct constexpr_reporter : reporter
                                  std::span<bs::string const> messages,
                                  bool                        result) noexcept override
     {
-        if (!result)
-            compose_messages(assertion, sloc, expansion, messages);
+        if (!result && m_test_case_failures < m_max_failures)
+        {
+            ++m_test_case_failures;
+            m_failures.push_back(compose_message(assertion, sloc, expansion, messages));
+        }
     }
 
+    [[nodiscard]] constexpr auto needs_passed_assertions() const noexcept -> bool override { return false; }
+    constexpr void               log_passed_assertions(std::size_t /*count*/) noexcept override {}
+
     constexpr void finalize() noexcept override {}
 
-    [[nodiscard]] constexpr auto messages() const noexcept { return m_messages; }
+    [[nodiscard]] constexpr auto failures() const noexcept -> std::span<failure_message const> { return m_failures; }
+
+    template<std::size_t MaxFailures>
+    [[nodiscard]] constexpr auto result(bool success) const -> constexpr_evaluation_result<MaxFailures>
+    {
+        constexpr_evaluation_result<MaxFailures> evaluation{.success = success};
+        evaluation.failure_count = std::min(MaxFailures, m_failures.size());
+        for (std::size_t i = 0; i < evaluation.failure_count; ++i)
+            evaluation.failures[i] = m_failures[i];
+        return evaluation;
+    }
 
   private:
-    static constexpr std::size_t            s_max_message_length = 2048;
-    structural_string<s_max_message_length> m_messages;
-    std::optional<section_path>             m_target;
+    std::size_t                 m_max_failures;
+    std::size_t                 m_test_case_failures = 0;
+    bs::vector<failure_message> m_failures;
+    std::optional<section_path> m_target;
 
     struct section_info
     {
@@ -93,29 +137,30 @@ struct constexpr_reporter : reporter
     };
     bs::vector<section_info> m_sections;
 
-    constexpr void compose_messages(std::string_view            assertion,
-                                    source_location             sloc,
-                                    std::string_view            expansion,
-                                    std::span<bs::string const> messages)
+    [[nodiscard]] constexpr auto compose_message(std::string_view            assertion,
+                                                 source_location             sloc,
+                                                 std::string_view            expansion,
+                                                 std::span<bs::string const> messages) const -> failure_message
     {
-        if (m_messages.size() > 0)
-            m_messages.append_as_fit(" ### ");
-        m_messages.append_as_fit("FAILURE: ");
-        m_messages.append_as_fit(bs::string{sloc.file_name} + ':' + to_string(sloc.line) + ": "
-                                 + bs::string{assertion});
+        failure_message message;
+        message.append("FAILURE: ").append(sloc.file_name).append(':').append(to_string(sloc.line));
+        message.append(": ").append(assertion);
         if (!expansion.empty())
-            m_messages.append_as_fit(bs::string{"; WITH EXPANSION: "} + bs::string{expansion});
+            message.append("; WITH EXPANSION: ").append(expansion);
         for (auto&& m : messages)
-            m_messages.append_as_fit(bs::string{"; WITH: "} + m);
+            message.append("; WITH: ").append(m);
         if (m_target)
         {
-            m_messages.append_as_fit(bs::string{"; AFTER RUNNING: "} + m_sections.front().name);
+            message.append("; AFTER RUNNING: ").append(m_sections.front().name);
             for (auto&& s : *m_target)
-                m_messages.append_as_fit(bs::string{"->"} + s);
+                message.append("->").append(s);
         }
         for (auto iter = m_sections.rbegin(); iter != m_sections.rend(); ++iter)
-            m_messages.append_as_fit(bs::string{"; IN: "} + bs::string{iter->sloc.file_name} + ':'
-                                     + to_string(iter->sloc.line) + ": " + iter->name);
+        {
+            message.append("; IN: ").append(iter->sloc.file_name).append(':').append(to_string(iter->sloc.line));
+            message.append(": ").append(iter->name);
+        }
+        return message;
     }
 };
 } // namespace bs
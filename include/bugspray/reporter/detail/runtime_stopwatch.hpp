@@ -35,10 +35,10 @@ struct runtime_stopwatch
     ~runtime_stopwatch();
 
     void start_test_case_timer();
-    auto stop_test_case_timer() -> std::chrono::milliseconds;
+    auto stop_test_case_timer() -> std::chrono::steady_clock::duration;
 
     void start_section_timer();
-    auto stop_section_timer() -> std::chrono::milliseconds;
+    auto stop_section_timer() -> std::chrono::steady_clock::duration;
 
   private:
     std::chrono::steady_clock::time_point              m_test_case_start_time;
@@ -47,6 +47,8 @@ struct formatted_ostream_reporter : reporter
     void start_run() noexcept override;
     void stop_run() noexcept override;
     void log_target(section_path const& target) noexcept override;
+    void log_benchmark(benchmark_result const& result) noexcept override;
+    void log_metric(std::string_view name, double value, std::string_view unit) noexcept override;
     void enter_section(std::string_view name, source_location sloc) noexcept override;
     void leave_section() noexcept override;
     void log_assertion(std::string_view            assertion,
@@ -54,6 +56,8 @@ struct formatted_ostream_reporter : reporter
                        std::string_view            expansion,
                        std::span<bs::string const> messages,
                        bool                        result) noexcept override;
+    [[nodiscard]] auto needs_passed_assertions() const noexcept -> bool override;
+    void               log_passed_assertions(std::size_t count) noexcept override;
     void finalize() noexcept override;
 
   private:
@@ -77,12 +81,15 @@ struct formatted_ostream_reporter : reporter
     };
 
     void report_test_case_head(test_case_data const& data);
+    void report_benchmark_head();
 
     test_case_data              m_cur_test_case;
     std::optional<section_path> m_cur_target;
     bs::vector<section_data>    m_cur_section;
     statistics                  m_stats;
     bool                        m_failed_assertion_in_this_test_case = false;
+    bool                        m_reported_test_case_head            = false;
+    bool                        m_reported_benchmark_head            = false;
     std::ostream&               m_stream;
 };
 } // namespace bs
@@ -0,0 +1,132 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef BUGSPRAY_MULTI_REPORTER_HPP
+#define BUGSPRAY_MULTI_REPORTER_HPP
+
+#include "bugspray/reporter/reporter.hpp"
+#include "bugspray/utility/vector.hpp"
+
+#include <algorithm>
+#include <span>
+#include <string_view>
+
+/*
+ * Forwards every event to a list of other reporters, in the order they were added. This allows observers like the
+ * sampling profiler to run alongside the reporter that produces the actual output.
+ */
+
+namespace bs
+{
+struct multi_reporter : reporter
+{
+#if defined(__GNUC__) && !defined(__clang__) && !defined(__INTEL_COMPILER)
+    // TODO: check if gcc bug https://gcc.gnu.org/bugzilla/show_bug.cgi?id=93413 is fixed
+    constexpr ~multi_reporter(){};
+#endif
+
+    constexpr void add(reporter& r) { m_reporters.push_back(&r); }
+
+    constexpr void enter_test_case(std::string_view                  name,
+                                   std::span<std::string_view const> tags,
+                                   source_location                   sloc) noexcept override
+    {
+        for (auto* r : m_reporters)
+            r->enter_test_case(name, tags, sloc);
+    }
+    constexpr void leave_test_case() noexcept override
+    {
+        for (auto* r : m_reporters)
+            r->leave_test_case();
+    }
+
+    constexpr void start_run() noexcept override
+    {
+        for (auto* r : m_reporters)
+            r->start_run();
+    }
+    constexpr void stop_run() noexcept override
+    {
+        for (auto* r : m_reporters)
+            r->stop_run();
+    }
+
+    constexpr void enter_section(std::string_view name, source_location sloc) noexcept override
+    {
+        for (auto* r : m_reporters)
+            r->enter_section(name, sloc);
+    }
+    constexpr void leave_section() noexcept override
+    {
+        for (auto* r : m_reporters)
+            r->leave_section();
+    }
+
+    constexpr void log_assertion(std::string_view            assertion,
+                                 source_location             sloc,
+                                 std::string_view            expansion,
+                                 std::span<bs::string const> messages,
+                                 bool                        result) noexcept override
+    {
+        for (auto* r : m_reporters)
+            r->log_assertion(assertion, sloc, expansion, messages, result);
+    }
+    [[nodiscard]] constexpr auto needs_passed_assertions() const noexcept -> bool override
+    {
+        return std::ranges::any_of(m_reporters, [](reporter const* r) { return r->needs_passed_assertions(); });
+    }
+    constexpr void log_passed_assertions(std::size_t count) noexcept override
+    {
+        for (auto* r : m_reporters)
+            r->log_passed_assertions(count);
+    }
+    constexpr void log_target(section_path const& target) noexcept override
+    {
+        for (auto* r : m_reporters)
+            r->log_target(target);
+    }
+    constexpr void log_benchmark(benchmark_result const& result) noexcept override
+    {
+        for (auto* r : m_reporters)
+            r->log_benchmark(result);
+    }
+
+    constexpr void log_metric(std::string_view name, double value, std::string_view unit) noexcept override
+    {
+        for (auto* r : m_reporters)
+            r->log_metric(name, value, unit);
+    }
+
+    constexpr void finalize() noexcept override
+    {
+        for (auto* r : m_reporters)
+            r->finalize();
+    }
+
+  private:
+    bs::vector<reporter*> m_reporters;
+};
+} // namespace bs
+
+#endif // BUGSPRAY_MULTI_REPORTER_HPP
@@ -60,7 +60,13 @@ struct noop_reporter : reporter
                                  bool /*result*/) noexcept override
     {
     }
+    [[nodiscard]] constexpr auto needs_passed_assertions() const noexcept -> bool override { return false; }
+    constexpr void               log_passed_assertions(std::size_t /*count*/) noexcept override {}
     constexpr void log_target(section_path const& /*target*/) noexcept override {}
+    constexpr void log_benchmark(benchmark_result const& /*result*/) noexcept override {}
+    constexpr void log_metric(std::string_view /*name*/, double /*value*/, std::string_view /*unit*/) noexcept override
+    {
+    }
 
     constexpr void finalize() noexcept override {}
 };
@@ -0,0 +1,90 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef BUGSPRAY_OVERHEAD_REPORTER_HPP
+#define BUGSPRAY_OVERHEAD_REPORTER_HPP
+
+#include "bugspray/reporter/reporter.hpp"
+#include "bugspray/test_evaluation/overhead_accounting.hpp"
+
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/*
+ * Wraps another reporter and installs an overhead_accountant for its lifetime. Time spent in the wrapped reporter is
+ * accounted as reporter overhead. On finalize, a table splitting each test case's time into test code and the
+ * different parts of the framework is written to the given stream.
+ */
+
+namespace bs
+{
+struct overhead_reporter : reporter
+{
+    overhead_reporter(reporter& inner, std::ostream& stream);
+    ~overhead_reporter() override;
+
+    overhead_reporter(overhead_reporter const&)                    = delete;
+    auto operator=(overhead_reporter const&) -> overhead_reporter& = delete;
+
+    void enter_test_case(std::string_view                  name,
+                         std::span<std::string_view const> tags,
+                         source_location                   sloc) noexcept override;
+    void leave_test_case() noexcept override;
+    void start_run() noexcept override;
+    void stop_run() noexcept override;
+    void log_target(section_path const& target) noexcept override;
+    void log_benchmark(benchmark_result const& result) noexcept override;
+    void log_metric(std::string_view name, double value, std::string_view unit) noexcept override;
+    void enter_section(std::string_view name, source_location sloc) noexcept override;
+    void leave_section() noexcept override;
+    void log_assertion(std::string_view            assertion,
+                       source_location             sloc,
+                       std::string_view            expansion,
+                       std::span<bs::string const> messages,
+                       bool                        result) noexcept override;
+    [[nodiscard]] auto needs_passed_assertions() const noexcept -> bool override;
+    void               log_passed_assertions(std::size_t count) noexcept override;
+    void finalize() noexcept override;
+
+  private:
+    struct test_case_overhead
+    {
+        std::string                    name;
+        overhead_accountant::durations durations;
+    };
+
+    void write_table();
+
+    reporter&                       m_inner;
+    std::ostream&                   m_stream;
+    overhead_accountant             m_accountant;
+    overhead_accountant*            m_previous_accountant;
+    std::string_view                m_current_test_case;
+    std::vector<test_case_overhead> m_test_cases;
+};
+} // namespace bs
+
+#endif // BUGSPRAY_OVERHEAD_REPORTER_HPP
@@ -25,6 +25,7 @@
 #ifndef BUGSPRAY_REPORTER_HPP
 #define BUGSPRAY_REPORTER_HPP
 
+#include "bugspray/benchmark/benchmark_result.hpp"
 #include "bugspray/test_evaluation/section_path.hpp"
 #include "bugspray/utility/source_location.hpp"
 #include "bugspray/utility/string.hpp"
@@ -32,6 +33,8 @@
 #include <span>
 #include <string_view>
 
+#include <cstddef>
+
 /*
  * Virtual base of any test result reporter. Declares APIs that will be called on important events during test
  * execution.
@@ -64,7 +67,15 @@ struct reporter
                                          std::string_view            expansion,
                                          std::span<bs::string const> messages,
                                          bool                        result) noexcept             = 0;
-    virtual constexpr void log_target(section_path const& target) noexcept = 0;
+    virtual constexpr void log_target(section_path const& target) noexcept        = 0;
+    virtual constexpr void log_benchmark(benchmark_result const& result) noexcept = 0;
+
+    virtual constexpr void log_metric(std::string_view name, double value, std::string_view unit) noexcept = 0;
+
+    // Passing assertions are only counted, unless the reporter needs each of them passed to log_assertion(). Counts are
+    // reported before any other event, so they belong to the current section.
+    [[nodiscard]] virtual constexpr auto needs_passed_assertions() const noexcept -> bool = 0;
+    virtual constexpr void log_passed_assertions(std::size_t count) noexcept              = 0;
 
     virtual constexpr void finalize() noexcept = 0;
 };
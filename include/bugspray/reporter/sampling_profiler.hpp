@@ -0,0 +1,96 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef BUGSPRAY_SAMPLING_PROFILER_HPP
+#define BUGSPRAY_SAMPLING_PROFILER_HPP
+
+#include "bugspray/reporter/reporter.hpp"
+
+#include <chrono>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <cstdint>
+
+/*
+ * Not a reporter in the classical sense: It observes test case and section boundaries while a SIGPROF interval timer
+ * samples the call stack. Samples are attributed to the active test case and section path and written as folded
+ * stacks (as consumed by flamegraph.pl or speedscope) on finalize. Only available on platforms providing <execinfo.h>
+ * and setitimer.
+ */
+
+namespace bs
+{
+struct sampling_profiler : reporter
+{
+    explicit sampling_profiler(std::ostream& stream, std::chrono::microseconds interval = std::chrono::milliseconds{1});
+    ~sampling_profiler() override;
+
+    sampling_profiler(sampling_profiler const&)                    = delete;
+    auto operator=(sampling_profiler const&) -> sampling_profiler& = delete;
+
+    [[nodiscard]] static auto is_supported() noexcept -> bool;
+
+    void enter_test_case(std::string_view                  name,
+                         std::span<std::string_view const> tags,
+                         source_location                   sloc) noexcept override;
+    void leave_test_case() noexcept override;
+    void start_run() noexcept override;
+    void stop_run() noexcept override;
+    void log_target(section_path const& target) noexcept override;
+    void log_benchmark(benchmark_result const& result) noexcept override;
+    void log_metric(std::string_view name, double value, std::string_view unit) noexcept override;
+    void enter_section(std::string_view name, source_location sloc) noexcept override;
+    void leave_section() noexcept override;
+    void log_assertion(std::string_view            assertion,
+                       source_location             sloc,
+                       std::string_view            expansion,
+                       std::span<bs::string const> messages,
+                       bool                        result) noexcept override;
+    [[nodiscard]] auto needs_passed_assertions() const noexcept -> bool override;
+    void               log_passed_assertions(std::size_t count) noexcept override;
+    void finalize() noexcept override;
+
+  private:
+    struct sample_buffer;
+
+    void update_context();
+    void stop_sampling();
+
+    std::ostream&                  m_stream;
+    std::unique_ptr<sample_buffer> m_buffer;
+
+    std::string_view         m_test_case;
+    std::vector<std::string> m_sections;
+
+    std::vector<std::string>                       m_contexts;
+    std::unordered_map<std::string, std::uint32_t> m_context_ids;
+};
+} // namespace bs
+
+#endif // BUGSPRAY_SAMPLING_PROFILER_HPP
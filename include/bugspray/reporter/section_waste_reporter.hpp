@@ -0,0 +1,111 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef BUGSPRAY_SECTION_WASTE_REPORTER_HPP
+#define BUGSPRAY_SECTION_WASTE_REPORTER_HPP
+
+#include "bugspray/reporter/detail/runtime_stopwatch.hpp"
+#include "bugspray/reporter/reporter.hpp"
+#include "bugspray/test_evaluation/test_case_topology.hpp"
+
+#include <chrono>
+#include <map>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/*
+ * Estimates how much time each test case spends re-executing code shared between its runs. Every run executes the
+ * unnamed root section and all sections on the path to its target again, so the self time (excluding nested
+ * sections) of each node is measured per run. Everything but one execution of each node is considered waste. On
+ * finalize, test cases are ranked by their waste, which is where restructuring or caching fixtures pays off the most.
+ */
+
+namespace bs
+{
+struct section_waste_reporter : reporter
+{
+    explicit section_waste_reporter(std::ostream& stream);
+
+    void enter_test_case(std::string_view                  name,
+                         std::span<std::string_view const> tags,
+                         source_location                   sloc) noexcept override;
+    void leave_test_case() noexcept override;
+    void start_run() noexcept override;
+    void stop_run() noexcept override;
+    void log_target(section_path const& target) noexcept override;
+    void log_benchmark(benchmark_result const& result) noexcept override;
+    void log_metric(std::string_view name, double value, std::string_view unit) noexcept override;
+    void enter_section(std::string_view name, source_location sloc) noexcept override;
+    void leave_section() noexcept override;
+    void log_assertion(std::string_view            assertion,
+                       source_location             sloc,
+                       std::string_view            expansion,
+                       std::span<bs::string const> messages,
+                       bool                        result) noexcept override;
+    [[nodiscard]] auto needs_passed_assertions() const noexcept -> bool override;
+    void               log_passed_assertions(std::size_t count) noexcept override;
+    void finalize() noexcept override;
+
+  private:
+    using duration = std::chrono::steady_clock::duration;
+
+    struct node_data
+    {
+        duration    self_time{};
+        std::size_t runs     = 0;
+        std::size_t last_run = 0;
+    };
+    struct open_node
+    {
+        std::string key;
+        duration    children_time{};
+    };
+    struct test_case_waste
+    {
+        std::string name;
+        std::size_t leaves = 0;
+        std::size_t runs   = 0;
+        duration    runtime{};
+        duration    waste{};
+    };
+
+    void open(std::string key);
+    auto close() -> duration;
+
+    std::ostream& m_stream;
+
+    detail::runtime_stopwatch        m_stopwatch;
+    test_case_topology               m_topology;
+    section_path                     m_current_path;
+    std::vector<open_node>           m_open_nodes;
+    std::map<std::string, node_data> m_nodes;
+    test_case_waste                  m_current;
+
+    std::vector<test_case_waste> m_test_cases;
+};
+} // namespace bs
+
+#endif // BUGSPRAY_SECTION_WASTE_REPORTER_HPP
@@ -0,0 +1,86 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef BUGSPRAY_TRACE_EVENT_REPORTER_HPP
+#define BUGSPRAY_TRACE_EVENT_REPORTER_HPP
+
+#include "bugspray/reporter/reporter.hpp"
+
+#include <chrono>
+#include <ostream>
+#include <string_view>
+
+#include <cstddef>
+#include <cstdint>
+
+/*
+ * Streams the Chrome trace event format (JSON), which can be loaded into Perfetto or chrome://tracing. Test cases,
+ * runs and sections become nested duration events, failed assertions become instant events and every run emits a
+ * counter track with its assertion results. Events are written as they happen, so memory usage does not grow with
+ * the length of the test suite.
+ */
+
+namespace bs
+{
+struct trace_event_reporter : reporter
+{
+    explicit trace_event_reporter(std::ostream& stream);
+
+    void enter_test_case(std::string_view                  name,
+                         std::span<std::string_view const> tags,
+                         source_location                   sloc) noexcept override;
+    void leave_test_case() noexcept override;
+    void start_run() noexcept override;
+    void stop_run() noexcept override;
+    void log_target(section_path const& target) noexcept override;
+    void log_benchmark(benchmark_result const& result) noexcept override;
+    void log_metric(std::string_view name, double value, std::string_view unit) noexcept override;
+    void enter_section(std::string_view name, source_location sloc) noexcept override;
+    void leave_section() noexcept override;
+    void log_assertion(std::string_view            assertion,
+                       source_location             sloc,
+                       std::string_view            expansion,
+                       std::span<bs::string const> messages,
+                       bool                        result) noexcept override;
+    [[nodiscard]] auto needs_passed_assertions() const noexcept -> bool override;
+    void               log_passed_assertions(std::size_t count) noexcept override;
+    void finalize() noexcept override;
+
+  private:
+    void begin_event(char phase, std::string_view name, std::string_view category);
+    void write_timestamp();
+    void write_string(std::string_view str);
+
+    std::ostream&                         m_stream;
+    std::chrono::steady_clock::time_point m_epoch;
+    std::uint64_t                         m_tid;
+    bool                                  m_first_event = true;
+
+    std::size_t m_run_index         = 0;
+    std::size_t m_passed_assertions = 0;
+    std::size_t m_failed_assertions = 0;
+};
+} // namespace bs
+
+#endif // BUGSPRAY_TRACE_EVENT_REPORTER_HPP
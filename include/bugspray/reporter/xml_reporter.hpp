@@ -53,6 +53,8 @@ struct xml_reporter : reporter
     void stop_run() noexcept override;
 
     void log_target(section_path const& target) noexcept override;
+    void log_benchmark(benchmark_result const& result) noexcept override;
+    void log_metric(std::string_view name, double value, std::string_view unit) noexcept override;
 
     void enter_section(std::string_view name, source_location sloc) noexcept override;
     void leave_section() noexcept override;
@@ -62,6 +64,8 @@ struct xml_reporter : reporter
                        std::string_view            expansion,
                        std::span<bs::string const> messages,
                        bool                        result) noexcept override;
+    [[nodiscard]] auto needs_passed_assertions() const noexcept -> bool override;
+    void               log_passed_assertions(std::size_t count) noexcept override;
 
     void finalize() noexcept override;
 
@@ -74,11 +78,25 @@ struct xml_reporter : reporter
         bs::vector<bs::string> messages;
         bool                   result;
     };
+    struct benchmark_data
+    {
+        bs::string       name;
+        benchmark_result result;
+    };
+    struct metric_data
+    {
+        bs::string name;
+        double     value;
+        bs::string unit;
+    };
     struct section_data;
     struct assertion_and_section_holder
     {
         bs::vector<assertion_data> assertions;
         bs::vector<section_data>   sections;
+        bs::vector<benchmark_data> benchmarks;
+        bs::vector<metric_data>    metrics;
+        std::size_t                passed_assertions = 0;
     };
     struct section_data : assertion_and_section_holder
     {
@@ -101,6 +119,9 @@ struct xml_reporter : reporter
     auto current_data() -> section_data&;
     void write_section(section_data const& sd);
     void write_assertions(results& r, bs::vector<assertion_data> const& ad);
+    void write_benchmarks(bs::vector<benchmark_data> const& bd);
+    void write_metrics(bs::vector<metric_data> const& md);
+    void write_estimate(std::string_view tag, benchmark_estimate const& estimate);
 
     xml_writer m_writer;
 
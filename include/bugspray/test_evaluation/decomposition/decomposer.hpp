@@ -31,7 +31,8 @@
 
 /*
  * Decomposes unary or binary expressions via left associativity. The resulting unary_expr or binary_expr cannot be
- * stored since it contains pointers to potential temporaries. Assign to decomposition_result instead.
+ * stored since it contains pointers to potential temporaries. Use it within the same full-expression, e.g. by passing
+ * it to test_run_data::check_assertion, or assign to decomposition_result instead.
  */
 
 namespace bs
@@ -29,33 +29,57 @@
 #include "bugspray/reporter/noop_reporter.hpp"
 #include "bugspray/reporter/reporter.hpp"
 #include "bugspray/test_evaluation/evaluate_test_case_target.hpp"
+#include "bugspray/test_evaluation/evaluation_stats.hpp"
+#include "bugspray/test_evaluation/overhead_accounting.hpp"
 #include "bugspray/test_evaluation/test_case.hpp"
 #include "bugspray/test_evaluation/test_case_filter.hpp"
 #include "bugspray/test_evaluation/test_run_data.hpp"
+#include "bugspray/utility/structural_buffer.hpp"
 #include "bugspray/utility/structural_string.hpp"
+#include "bugspray/utility/usdt_probes.hpp"
+
+#include <utility>
 
 /*
- * Evaluates a test case by calling the function multiple times until every section has been called once.
+ * Evaluates a test case by calling the function multiple times until every section has been called once. If stats are
+ * given, the runs, sections, assertions and captures of the evaluation are added to them.
  */
 
 namespace bs
 {
 template<bool AbortEarly = false>
-constexpr auto evaluate_test_case(test_case const& tc, reporter& the_reporter, std::string_view test_spec = "") -> bool
+constexpr auto evaluate_test_case(test_case const&  tc,
+                                  reporter&         the_reporter,
+                                  std::string_view  test_spec = "",
+                                  evaluation_stats* stats     = nullptr) -> bool
 {
     if (!test_case_filter(tc, test_spec))
         return true;
 
+    overhead_scope const evaluation_scope{overhead_category::evaluation};
+
     bool               success = true;
     test_case_topology topo;
 
+    BUGSPRAY_USDT_PROBE4(enter_test_case,
+                         tc.name.data(),
+                         tc.name.size(),
+                         tc.source_location.file_name.data(),
+                         tc.source_location.line);
     the_reporter.enter_test_case(tc.name, tc.tags, tc.source_location);
     while (!topo.all_done())
     {
+        BUGSPRAY_USDT_PROBE2(start_run, tc.name.data(), tc.name.size());
         the_reporter.start_run();
+        if (stats)
+            ++stats->runs;
 
-        test_run_data data{the_reporter, topo};
-        success &= evaluate_test_case_target(tc, data);
+        test_run_data data{the_reporter, topo, stats, tc.name};
+        {
+            overhead_scope const test_code_scope{overhead_category::test_code};
+            success &= evaluate_test_case_target(tc, data);
+        }
+        data.flush_passed_assertions();
 
         if (data.target())
             topo.mark_done(*data.target());
@@ -74,16 +98,27 @@ constexpr auto evaluate_test_case(test_case const& tc, reporter& the_reporter, s
         }
     }
     the_reporter.leave_test_case();
+    BUGSPRAY_USDT_PROBE3(leave_test_case, tc.name.data(), tc.name.size(), success);
 
     return success;
 }
 
-template<auto>
+template<auto, std::size_t MaxFailures = 1>
 constexpr auto evaluate_test_case_constexpr(test_case const& tc, std::string_view test_spec = "")
+{
+    // With a single failure to report, there is no point in evaluating further runs after it
+    ::bs::constexpr_reporter reporter{MaxFailures};
+    auto const               result = evaluate_test_case<MaxFailures == 1>(tc, reporter, test_spec);
+    return reporter.result<MaxFailures>(result);
+}
+
+template<auto>
+constexpr auto evaluate_test_case_constexpr_stats(test_case const& tc, std::string_view test_spec = "")
 {
     ::bs::constexpr_reporter reporter;
-    auto const               result = evaluate_test_case<true>(tc, reporter, test_spec);
-    return std::make_pair(result, reporter.messages());
+    evaluation_stats         stats;
+    evaluate_test_case<true>(tc, reporter, test_spec, &stats);
+    return stats;
 }
 
 template<structural_string... Messages>
@@ -91,6 +126,16 @@ constexpr void compile_time_error()
 {
     static_assert((sizeof...(Messages), false), "Test evaluation failed.");
 }
+
+// Fails compilation with the messages of all failures in the given constexpr_evaluation_result
+template<auto Result>
+constexpr void report_compile_time_failures()
+{
+    []<std::size_t... Indices>(std::index_sequence<Indices...>)
+    {
+        compile_time_error<::bs::to_structural_string<Result.failures[Indices]>()...>();
+    }(std::make_index_sequence<Result.failure_count>{});
+}
 } // namespace bs
 
 #endif // BUGSPRAY_EVALUATE_TEST_CASE_HPP
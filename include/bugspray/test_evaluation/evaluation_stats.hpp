@@ -0,0 +1,48 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#ifndef BUGSPRAY_EVALUATION_STATS_HPP
+#define BUGSPRAY_EVALUATION_STATS_HPP
+
+#include <cstddef>
+
+/*
+ * evaluation_stats tallies the work done while evaluating a test case. Its main purpose is to make the cost of
+ * constexpr evaluation visible, which is bounded by compiler limits such as -fconstexpr-ops-limit. See
+ * BUGSPRAY_EVAL_TEST_CASE_STATS.
+ */
+
+namespace bs
+{
+struct evaluation_stats
+{
+    std::size_t runs       = 0;
+    std::size_t sections   = 0;
+    std::size_t assertions = 0;
+    std::size_t captures   = 0;
+
+    constexpr auto operator==(evaluation_stats const&) const noexcept -> bool = default;
+};
+} // namespace bs
+
+#endif // BUGSPRAY_EVALUATION_STATS_HPP
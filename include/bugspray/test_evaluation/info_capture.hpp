@@ -25,6 +25,7 @@
 #ifndef BUGSPRAY_INFO_CAPTURE_HPP
 #define BUGSPRAY_INFO_CAPTURE_HPP
 
+#include "bugspray/test_evaluation/overhead_accounting.hpp"
 #include "bugspray/test_evaluation/test_run_data.hpp"
 #include "bugspray/to_string/stringify.hpp"
 #include "bugspray/utility/string.hpp"
@@ -47,6 +48,7 @@ struct info_capture
         : m_bugspray_data(bugspray_data)
         , m_count(1)
     {
+        overhead_scope const scope{overhead_category::captures};
         m_bugspray_data.push_message(message);
     }
 
@@ -56,12 +58,14 @@ struct info_capture
         : m_bugspray_data(bugspray_data)
         , m_count(messages.size())
     {
+        overhead_scope const scope{overhead_category::captures};
         for (auto&& m : messages)
             m_bugspray_data.push_message(m);
     }
 
     constexpr ~info_capture() noexcept
     {
+        overhead_scope const scope{overhead_category::captures};
         for (std::size_t i = 0; i < m_count; ++i)
             m_bugspray_data.pop_message();
     }
@@ -131,6 +135,7 @@ constexpr auto info_capture_stringification_helper(test_run_data&
                                                    Ts&&... things)
 {
     static_assert(I == sizeof...(Ts));
+    overhead_scope const scope{overhead_category::captures};
     std::array<bs::string, I> values{stringify(std::forward<Ts>(things))...};
     for (std::size_t i = 0; i < I; ++i)
         values[i] = bs::string{names[i]} + ": " + values[i];
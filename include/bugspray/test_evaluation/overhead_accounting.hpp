@@ -0,0 +1,132 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef BUGSPRAY_OVERHEAD_ACCOUNTING_HPP
+#define BUGSPRAY_OVERHEAD_ACCOUNTING_HPP
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <type_traits>
+
+#include <cstddef>
+#include <cstdint>
+
+/*
+ * Attributes wall-clock time to categories of framework code versus test code. Instrumented code opens an
+ * overhead_scope for its category; time is always charged to the innermost open scope, so nested scopes are not
+ * counted twice. Accounting only happens at runtime and only while an overhead_accountant is installed, e.g. by
+ * running a test executable with --measure-overhead. Otherwise a scope costs a single pointer check.
+ */
+
+namespace bs
+{
+enum class overhead_category : std::uint8_t
+{
+    test_code,
+    evaluation,
+    sections,
+    assertions,
+    captures,
+    reporter,
+};
+
+inline constexpr std::size_t overhead_category_count = 6;
+
+struct overhead_accountant
+{
+    using clock     = std::chrono::steady_clock;
+    using durations = std::array<clock::duration, overhead_category_count>;
+
+    void enter(overhead_category category)
+    {
+        charge();
+        if (m_depth < m_stack.size())
+            m_stack[m_depth] = category;
+        ++m_depth;
+    }
+
+    void leave()
+    {
+        charge();
+        --m_depth;
+    }
+
+    void reset()
+    {
+        m_totals = {};
+        m_last   = clock::now();
+    }
+
+    [[nodiscard]] auto totals() -> durations const&
+    {
+        charge();
+        return m_totals;
+    }
+
+  private:
+    void charge()
+    {
+        auto const now = clock::now();
+        if (m_depth > 0)
+            m_totals[static_cast<std::size_t>(m_stack[std::min(m_depth, m_stack.size()) - 1])] += now - m_last;
+        m_last = now;
+    }
+
+    std::array<overhead_category, 32> m_stack{};
+    std::size_t                       m_depth = 0;
+    durations                         m_totals{};
+    clock::time_point                 m_last = clock::now();
+};
+
+inline overhead_accountant* g_overhead_accountant = nullptr;
+
+struct overhead_scope
+{
+    constexpr explicit overhead_scope(overhead_category category) noexcept
+    {
+        if (!std::is_constant_evaluated() && g_overhead_accountant != nullptr)
+        {
+            m_accountant = g_overhead_accountant;
+            m_accountant->enter(category);
+        }
+    }
+
+    constexpr ~overhead_scope() noexcept
+    {
+        if (m_accountant != nullptr)
+            m_accountant->leave();
+    }
+
+    overhead_scope(overhead_scope const&)                    = delete;
+    overhead_scope(overhead_scope&&)                         = delete;
+    auto operator=(overhead_scope const&) -> overhead_scope& = delete;
+    auto operator=(overhead_scope&&) -> overhead_scope&      = delete;
+
+  private:
+    overhead_accountant* m_accountant = nullptr;
+};
+} // namespace bs
+
+#endif // BUGSPRAY_OVERHEAD_ACCOUNTING_HPP
@@ -25,6 +25,7 @@
 #ifndef BUGSPRAY_SECTION_TRACKER_HPP
 #define BUGSPRAY_SECTION_TRACKER_HPP
 
+#include "bugspray/test_evaluation/overhead_accounting.hpp"
 #include "bugspray/test_evaluation/test_run_data.hpp"
 #include "bugspray/utility/source_location.hpp"
 
@@ -48,6 +49,7 @@ struct section_tracker
                                        bool             active) noexcept
         : m_data(data)
     {
+        overhead_scope const scope{overhead_category::sections};
         if (active)
         {
             m_data.topology().chart(data.current(), name);
@@ -62,7 +64,10 @@ struct section_tracker
     constexpr ~section_tracker() noexcept
     {
         if (m_active)
+        {
+            overhead_scope const scope{overhead_category::sections};
             m_data.leave_section();
+        }
     }
 
     constexpr operator bool() const noexcept { return m_active; }
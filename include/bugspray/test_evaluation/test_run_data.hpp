@@ -26,15 +26,21 @@
 #define BUGSPRAY_TEST_RUN_DATA_HPP
 
 #include "bugspray/reporter/reporter.hpp"
+#include "bugspray/test_evaluation/evaluation_stats.hpp"
+#include "bugspray/test_evaluation/overhead_accounting.hpp"
 #include "bugspray/test_evaluation/section_path.hpp"
 #include "bugspray/test_evaluation/test_case_topology.hpp"
+#include "bugspray/utility/macros/macro_attributes.hpp"
 #include "bugspray/utility/source_location.hpp"
 #include "bugspray/utility/string.hpp"
+#include "bugspray/utility/usdt_probes.hpp"
 
 #include <optional>
 #include <span>
 #include <string_view>
+#include <utility>
 
+#include <cstddef>
 #include <cstdint>
 
 /*
@@ -42,7 +48,11 @@
  *   - the target section. This informs the test case which sections to enter and which to skip.
  *   - the test case topology. This is an out parameter, and used to inform the test runner about future targets.
  *   - the current section. Used by the test case to chart the topology.
- *   - ways to enter sections, log assertions, and mark the test run as failed.
+ *   - ways to enter sections, log assertions, benchmarks and metrics, and mark the test run as failed.
+ *   - the number of passing assertions not yet reported. Unless the reporter needs every passing assertion, they are
+ *     only counted and reported in bulk before the next event.
+ *   - optionally, evaluation_stats that count the sections, assertions and captures of the run.
+ *   - optionally, the name of the test case, e.g. to identify benchmarks across runs.
  * Instances of this class are neither copyable nor movable, since they should only be passed by mutable reference
  * inside the test case.
  */
@@ -51,12 +61,20 @@ namespace bs
 {
 struct test_run_data
 {
-    constexpr explicit test_run_data(reporter& the_reporter, test_case_topology& topo)
+    constexpr explicit test_run_data(reporter&           the_reporter,
+                                     test_case_topology& topo,
+                                     evaluation_stats*   stats          = nullptr,
+                                     std::string_view    test_case_name = {})
         : m_reporter(the_reporter)
         , m_topology(topo)
+        , m_stats(stats)
+        , m_test_case_name(test_case_name)
+        , m_log_passed_assertions(the_reporter.needs_passed_assertions())
     {
     }
 
+    [[nodiscard]] constexpr auto test_case_name() const noexcept -> std::string_view { return m_test_case_name; }
+
     [[nodiscard]] constexpr auto topology() noexcept -> test_case_topology& { return m_topology; }
     [[nodiscard]] constexpr auto target() const noexcept -> std::optional<section_path> const& { return m_target; }
     [[nodiscard]] constexpr auto current() const noexcept -> section_path const& { return m_cur_path; }
@@ -85,18 +103,24 @@ struct test_run_data
 
     constexpr void enter_section(std::string_view name, source_location sloc) noexcept
     {
+        flush_passed_assertions();
         m_cur_path.push_back(bs::string{name});
+        if (m_stats)
+            ++m_stats->sections;
+        BUGSPRAY_USDT_PROBE3(enter_section, name.data(), name.size(), m_cur_path.size());
         m_reporter.enter_section(name, sloc);
     }
 
     constexpr void leave_section() noexcept
     {
         assert(!m_cur_path.empty());
+        flush_passed_assertions();
         if (!m_target)
         {
             m_target = m_cur_path;
             m_reporter.log_target(m_target.value());
         }
+        BUGSPRAY_USDT_PROBE1(leave_section, m_cur_path.size());
         m_cur_path.pop_back();
         m_reporter.leave_section();
     }
@@ -109,10 +133,84 @@ struct test_run_data
     constexpr void
     log_assertion(std::string_view assertion, source_location sloc, std::string_view expansion, bool result) noexcept
     {
+        overhead_scope const scope{overhead_category::assertions};
+        flush_passed_assertions();
+        if (m_stats)
+            ++m_stats->assertions;
+        if (!result)
+        {
+            BUGSPRAY_USDT_PROBE4(assertion_failed,
+                                 assertion.data(),
+                                 assertion.size(),
+                                 sloc.file_name.data(),
+                                 sloc.line);
+        }
         m_reporter.log_assertion(assertion, sloc, expansion, m_messages, result);
     }
 
-    constexpr void push_message(bs::string const& message) { m_messages.push_back(message); }
+    // Whether passing assertions must be logged with their expansion, instead of only being counted
+    [[nodiscard]] constexpr auto logs_passed_assertions() const noexcept -> bool { return m_log_passed_assertions; }
+    constexpr void               count_passed_assertion() noexcept { ++m_passed_assertions; }
+
+    // Checks a decomposed expression. A passing assertion is only counted, unless the reporter needs it logged. Only
+    // then, or if the assertion fails, is the expression stringified. Returns whether the assertion passed.
+    template<typename Expr>
+    constexpr auto check_assertion(std::string_view assertion, source_location sloc, Expr const& expr, bool abort)
+        -> bool
+    {
+        bool const passed = expr.result();
+        if (passed && !m_log_passed_assertions) [[likely]]
+            count_passed_assertion();
+        else
+            report_expression(assertion, sloc, expr, passed, abort);
+        return passed;
+    }
+
+    // Logs an assertion. If it failed, marks the run as failed, and aborted if requested. Kept out of line, so that
+    // assertion sites only contain the code for the counted case.
+    BUGSPRAY_COLD_PATH constexpr void report_assertion(std::string_view assertion,
+                                                       source_location  sloc,
+                                                       std::string_view expansion,
+                                                       bool             result,
+                                                       bool             abort) noexcept
+    {
+        log_assertion(assertion, sloc, expansion, result);
+        if (!result)
+        {
+            mark_failed();
+            if (abort)
+                mark_aborted();
+        }
+    }
+
+    // Reports the passing assertions counted since the last event
+    constexpr void flush_passed_assertions() noexcept
+    {
+        if (m_passed_assertions == 0)
+            return;
+        if (m_stats)
+            m_stats->assertions += m_passed_assertions;
+        m_reporter.log_passed_assertions(std::exchange(m_passed_assertions, 0));
+    }
+
+    constexpr void log_benchmark(benchmark_result const& result) noexcept
+    {
+        flush_passed_assertions();
+        m_reporter.log_benchmark(result);
+    }
+
+    constexpr void log_metric(std::string_view name, double value, std::string_view unit) noexcept
+    {
+        flush_passed_assertions();
+        m_reporter.log_metric(name, value, unit);
+    }
+
+    constexpr void push_message(bs::string const& message)
+    {
+        if (m_stats)
+            ++m_stats->captures;
+        m_messages.push_back(message);
+    }
 
     constexpr void pop_message()
     {
@@ -120,7 +218,7 @@ struct test_run_data
         m_messages.pop_back();
     }
 
-    constexpr ~test_run_data() = default;
+    constexpr ~test_run_data() { flush_passed_assertions(); }
 
     constexpr test_run_data(test_run_data const&)                    = delete;
     constexpr test_run_data(test_run_data&&)                         = delete;
@@ -128,13 +226,30 @@ struct test_run_data
     constexpr auto operator=(test_run_data&&) -> test_run_data&      = delete;
 
   private:
+    template<typename Expr>
+    BUGSPRAY_COLD_PATH constexpr void
+    report_expression(std::string_view assertion, source_location sloc, Expr const& expr, bool result, bool abort)
+    {
+        bs::string const expansion = [&]
+        {
+            // Evaluating the operands is test code, stringifying them is assertion overhead
+            overhead_scope const scope{overhead_category::assertions};
+            return expr.str();
+        }();
+        report_assertion(assertion, sloc, expansion, result, abort);
+    }
+
     reporter&                   m_reporter;
     test_case_topology&         m_topology;
+    evaluation_stats*           m_stats;
+    std::string_view            m_test_case_name;
     section_path                m_cur_path;
     std::optional<section_path> m_target;
     bool                        m_success = true;
     bool                        m_abort   = false;
     bs::vector<bs::string>      m_messages;
+    bool                        m_log_passed_assertions;
+    std::size_t                 m_passed_assertions = 0;
 };
 } // namespace bs
 
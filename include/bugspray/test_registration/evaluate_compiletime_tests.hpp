@@ -0,0 +1,168 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#ifndef BUGSPRAY_EVALUATE_COMPILETIME_TESTS_HPP
+#define BUGSPRAY_EVALUATE_COMPILETIME_TESTS_HPP
+
+#include "bugspray/reporter/constexpr_reporter.hpp"
+#include "bugspray/test_evaluation/evaluate_test_case.hpp"
+#include "bugspray/test_evaluation/test_case_filter.hpp"
+#include "bugspray/test_registration/test_case_registry.hpp"
+#include "bugspray/utility/structural_string.hpp"
+
+#include <string_view>
+#include <utility>
+
+#include <cstddef>
+
+/*
+ * Evaluates the first Count compile time test cases registered in the translation unit identified by Tag. Test cases
+ * not matching the test spec are not evaluated. Each test case is evaluated in its own constant expression, so it has
+ * the full evaluation step budget of the compiler (-fconstexpr-ops-limit, -fconstexpr-steps) to itself. Failing test
+ * cases do not stop the evaluation of the others. They are evaluated a second time into a single constexpr_reporter,
+ * so up to MaxFailures failures of every test case are reported together.
+ * The test cases are visited in chunks, so that no fold expression grows beyond compiletime_test_chunk_size.
+ */
+
+namespace bs
+{
+namespace detail
+{
+inline constexpr int compiletime_test_chunk_size = 64;
+
+struct compiletime_tests_summary
+{
+    bool        success       = true;
+    std::size_t failure_count = 0;
+};
+
+template<typename Tag, int Index, structural_string TestSpec, std::size_t MaxFailures>
+constexpr auto summarize_compiletime_test_entry() -> compiletime_tests_summary
+{
+    constexpr test_case const& tc = *compiletime_test_entry<Tag, Index>::value;
+    if constexpr (test_case_filter(tc, std::string_view{TestSpec}))
+    {
+        ::bs::constexpr_reporter reporter{MaxFailures};
+        bool const               success = evaluate_test_case<MaxFailures == 1>(tc, reporter);
+        return {success, reporter.failures().size()};
+    }
+    else
+        return {};
+}
+
+// A variable template, so that every test case is evaluated in a constant expression of its own
+template<typename Tag, int Index, structural_string TestSpec, std::size_t MaxFailures>
+inline constexpr compiletime_tests_summary compiletime_test_entry_summary =
+    summarize_compiletime_test_entry<Tag, Index, TestSpec, MaxFailures>();
+
+template<typename Tag, int Begin, int End, structural_string TestSpec, std::size_t MaxFailures>
+constexpr auto summarize_compiletime_test_range() -> compiletime_tests_summary
+{
+    if constexpr (End - Begin <= compiletime_test_chunk_size)
+    {
+        return []<int... Offsets>(std::integer_sequence<int, Offsets...>)
+        {
+            compiletime_tests_summary summary;
+            auto const add = [&](compiletime_tests_summary const& entry)
+            {
+                summary.success &= entry.success;
+                summary.failure_count += entry.failure_count;
+            };
+            (add(compiletime_test_entry_summary<Tag, Begin + Offsets, TestSpec, MaxFailures>), ...);
+            return summary;
+        }(std::make_integer_sequence<int, End - Begin>{});
+    }
+    else
+    {
+        constexpr int mid   = Begin + (End - Begin) / 2;
+        auto const    first = summarize_compiletime_test_range<Tag, Begin, mid, TestSpec, MaxFailures>();
+        auto const    last  = summarize_compiletime_test_range<Tag, mid, End, TestSpec, MaxFailures>();
+        return {first.success && last.success, first.failure_count + last.failure_count};
+    }
+}
+
+// Only failing test cases are evaluated again, to collect their failure messages
+template<typename Tag, int Index, structural_string TestSpec, std::size_t MaxFailures>
+constexpr auto evaluate_compiletime_test_entry(constexpr_reporter& reporter) -> bool
+{
+    constexpr auto summary = compiletime_test_entry_summary<Tag, Index, TestSpec, MaxFailures>;
+    if constexpr (summary.failure_count == 0)
+        return summary.success;
+    else
+        return evaluate_test_case<MaxFailures == 1>(*compiletime_test_entry<Tag, Index>::value, reporter);
+}
+
+template<typename Tag, int Begin, int End, structural_string TestSpec, std::size_t MaxFailures>
+constexpr auto evaluate_compiletime_test_range(constexpr_reporter& reporter) -> bool
+{
+    if constexpr (End - Begin <= compiletime_test_chunk_size)
+    {
+        return [&]<int... Offsets>(std::integer_sequence<int, Offsets...>)
+        {
+            bool success = true;
+            ((success &= evaluate_compiletime_test_entry<Tag, Begin + Offsets, TestSpec, MaxFailures>(reporter)), ...);
+            return success;
+        }(std::make_integer_sequence<int, End - Begin>{});
+    }
+    else
+    {
+        constexpr int mid     = Begin + (End - Begin) / 2;
+        bool const    success = evaluate_compiletime_test_range<Tag, Begin, mid, TestSpec, MaxFailures>(reporter);
+        return evaluate_compiletime_test_range<Tag, mid, End, TestSpec, MaxFailures>(reporter) && success;
+    }
+}
+
+template<typename Tag, int Count, structural_string TestSpec, std::size_t MaxFailures>
+constexpr auto summarize_compiletime_tests() -> compiletime_tests_summary
+{
+    return summarize_compiletime_test_range<Tag, 0, Count, TestSpec, MaxFailures>();
+}
+} // namespace detail
+
+// The result is sized to the number of failures, since it is passed on as NTTP. The tests are evaluated once to count
+// the failures, and only the failing ones a second time to collect their messages.
+template<typename Tag, int Count, structural_string TestSpec, std::size_t MaxFailures = 1>
+constexpr auto evaluate_compiletime_tests_constexpr()
+{
+    constexpr auto summary = detail::summarize_compiletime_tests<Tag, Count, TestSpec, MaxFailures>();
+    if constexpr (summary.failure_count == 0)
+        return constexpr_evaluation_result<0>{.success = summary.success};
+    else
+    {
+        ::bs::constexpr_reporter reporter{MaxFailures};
+        bool const success = detail::evaluate_compiletime_test_range<Tag, 0, Count, TestSpec, MaxFailures>(reporter);
+        return reporter.result<summary.failure_count>(success);
+    }
+}
+
+template<typename Tag, int Count, structural_string TestSpec, std::size_t MaxFailures = 1>
+constexpr auto evaluate_compiletime_tests() -> bool
+{
+    constexpr auto results = evaluate_compiletime_tests_constexpr<Tag, Count, TestSpec, MaxFailures>();
+    if constexpr (!results.success)
+        report_compile_time_failures<results>();
+    return results.success;
+}
+} // namespace bs
+
+#endif // BUGSPRAY_EVALUATE_COMPILETIME_TESTS_HPP
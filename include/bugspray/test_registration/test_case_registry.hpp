@@ -25,7 +25,9 @@
 #ifndef BUGSPRAY_TEST_CASE_REGISTRY_HPP
 #define BUGSPRAY_TEST_CASE_REGISTRY_HPP
 
+#include "bugspray/test_evaluation/evaluation_stats.hpp"
 #include "bugspray/test_evaluation/test_case.hpp"
+#include "bugspray/utility/macros/macro_warning_suppression.hpp"
 #include "bugspray/utility/structural_string.hpp"
 #include "bugspray/utility/vector.hpp"
 
@@ -35,6 +37,90 @@ namespace bs
 {
 inline bs::vector<std::reference_wrapper<test_case const>> g_test_case_registry;
 
+namespace detail
+{
+namespace
+{
+// A distinct type in every translation unit. Compile time test lists are keyed by it, which keeps them local to the
+// translation unit without giving the templates themselves internal linkage.
+struct translation_unit_tag
+{
+};
+} // namespace
+
+/*
+ * Compile time test cases register themselves by specializing this template for the next free index, with a static
+ * member `value` pointing to the test case. Indices are dense, i.e. the test cases of a translation unit are numbered
+ * 0, 1, 2, ... in the order of their definition.
+ */
+template<typename Tag, int Index>
+struct compiletime_test_entry
+{
+};
+
+/*
+ * Hands out the dense indices. Taking an index defines the friend function declared by compiletime_test_slot, and
+ * whether it is defined yet can be queried later on. Slots are taken in order, so the number of taken slots is found
+ * by a binary search. Every query passes a unique value, e.g. __COUNTER__, so that its result is not cached.
+ * This is stateful metaprogramming, which CWG 2118 intends to make ill-formed. Compilers accept it nonetheless, and
+ * GCC's -Wnon-template-friend warning about the friend declaration is silenced.
+ */
+BUGSPRAY_DISABLE_WARNING_PUSH
+BUGSPRAY_DISABLE_WARNING_NON_TEMPLATE_FRIEND
+template<typename Tag, int Index>
+struct compiletime_test_slot
+{
+    friend constexpr auto compiletime_test_slot_taken(compiletime_test_slot);
+};
+BUGSPRAY_DISABLE_WARNING_POP
+
+template<typename Tag, int Index>
+struct take_compiletime_test_slot
+{
+    friend constexpr auto compiletime_test_slot_taken(compiletime_test_slot<Tag, Index>) { return true; }
+};
+
+template<typename Tag, int Index, int Unique>
+constexpr auto is_compiletime_test_slot_taken() -> bool
+{
+    return requires { compiletime_test_slot_taken(compiletime_test_slot<Tag, Index>{}); };
+}
+
+// First free slot in [Low, High], knowing that all slots below Low are taken and High is free
+template<typename Tag, int Low, int High, int Unique>
+constexpr auto first_free_compiletime_test_slot() -> int
+{
+    if constexpr (Low == High)
+        return Low;
+    else
+    {
+        constexpr int mid = Low + (High - Low) / 2;
+        if constexpr (is_compiletime_test_slot_taken<Tag, mid, Unique>())
+            return first_free_compiletime_test_slot<Tag, mid + 1, High, Unique>();
+        else
+            return first_free_compiletime_test_slot<Tag, Low, mid, Unique>();
+    }
+}
+
+// Number of compile time test cases registered so far, doubling Size until slot Size - 1 is free
+template<typename Tag, int Unique, int Size = 1>
+constexpr auto compiletime_test_count() -> int
+{
+    if constexpr (is_compiletime_test_slot_taken<Tag, Size - 1, Unique>())
+        return compiletime_test_count<Tag, Unique, Size * 2>();
+    else
+        return first_free_compiletime_test_slot<Tag, Size / 2, Size - 1, Unique>();
+}
+
+template<typename Tag, int Unique>
+constexpr auto next_compiletime_test_index() -> int
+{
+    constexpr int index = compiletime_test_count<Tag, Unique>();
+    (void)take_compiletime_test_slot<Tag, index>{};
+    return index;
+}
+} // namespace detail
+
 template<structural_string Name, int Bogus>
 struct evaluate_compiletime_test
 {
@@ -43,6 +129,11 @@ struct evaluate_compiletime_test
         static_assert((Name, false), "There is no constexpr-enabled test with this name");
         return false;
     }
+    constexpr auto stats() -> evaluation_stats
+    {
+        static_assert((Name, false), "There is no constexpr-enabled test with this name");
+        return {};
+    }
 };
 } // namespace bs
 
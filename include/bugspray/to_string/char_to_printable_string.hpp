@@ -25,12 +25,40 @@
 #ifndef BUGSPRAY_CHAR_TO_PRINTABLE_STRING_HPP
 #define BUGSPRAY_CHAR_TO_PRINTABLE_STRING_HPP
 
+#include "bugspray/to_string/string_sink.hpp"
 #include "bugspray/to_string/to_string_integral.hpp"
+#include "bugspray/utility/character.hpp"
 #include "bugspray/utility/string.hpp"
 
+#include <array>
+#include <string_view>
+#include <type_traits>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+/*
+ * Characters are printed as they are, unless they are a backslash, a control character or can't be represented by a
+ * single char. Those are escaped. append_printable() writes a character into a sink, printable_prefix_length() finds
+ * runs of characters that can be copied as they are. At runtime, it checks eight bytes at a time (SWAR), so strings
+ * without escapes are copied in bulk.
+ */
+
 namespace bs
 {
-constexpr auto char_to_printable_string(char c) -> bs::string
+namespace detail
+{
+template<std::size_t Digits, string_sink Sink>
+constexpr void append_hex_escape(Sink& sink, std::uint32_t value)
+{
+    std::array<char, Digits + 2> buffer{'\\', 'x'};
+    for (std::size_t i = buffer.size(); i-- > 2; value >>= 4)
+        buffer[i] = g_digits[value & 0xfu];
+    sink.append(std::string_view{buffer.data(), buffer.size()});
+}
+
+constexpr auto named_escape(char c) -> std::string_view
 {
     switch (c)
     {
@@ -52,43 +80,115 @@ constexpr auto char_to_printable_string(char c) -> bs::string
         return R"(\v)";
     case '\0':
         return R"(\0)";
-    default:;
+    default:
+        return {};
     }
-    if ((c > '\x00' && c < '\x1f') || c == '\x7f')
+}
+
+// Whether append_printable() writes c as the single char c
+template<character CharT>
+constexpr auto is_printable_as_is(CharT c) -> bool
+{
+    if constexpr (std::same_as<CharT, wchar_t>)
+        return false;
+    else if constexpr (std::same_as<CharT, char16_t> || std::same_as<CharT, char32_t>)
+        return c < 128u && is_printable_as_is(static_cast<char>(c));
+    else if constexpr (std::same_as<CharT, char8_t>)
+        return is_printable_as_is(static_cast<char>(c));
+    else
+        return c != '\\' && (c < '\x00' || c >= '\x1f') && c != '\x7f';
+}
+
+// Checks all CharT lanes of word at once for characters that aren't printable as they are
+template<character CharT>
+constexpr auto word_needs_escape(std::uint64_t word) -> bool
+{
+    constexpr auto bits      = 8 * sizeof(CharT);
+    constexpr auto lane_mask = (std::uint64_t{1} << bits) - 1;
+    constexpr auto ones      = ~std::uint64_t{0} / lane_mask;
+    constexpr auto highs     = ones << (bits - 1);
+
+    // Exact in whether any lane matches, though lanes after a matching one may match spuriously
+    auto const has_less = [](std::uint64_t v, std::uint64_t n) { return ((v - ones * n) & ~v & highs) != 0; };
+    auto const has_zero = [&](std::uint64_t v) { return has_less(v, 1); };
+
+    bool const non_ascii = sizeof(CharT) > 1 && (word & ones * (lane_mask & ~std::uint64_t{0x7f})) != 0;
+    return non_ascii || has_less(word, 0x1f) || has_zero(word ^ ones * '\\') || has_zero(word ^ ones * 0x7f);
+}
+} // namespace detail
+
+// Returns the number of leading characters of [first, first + size) that are printable as they are
+template<character CharT>
+constexpr auto printable_prefix_length(CharT const* first, std::size_t size) -> std::size_t
+{
+    if constexpr (std::same_as<CharT, wchar_t>)
+        return 0;
+    else
     {
-        auto const s = to_string<16, 2>(static_cast<unsigned char>(c));
-        return R"(\x)" + s;
+        constexpr std::size_t chars_per_word = sizeof(std::uint64_t) / sizeof(CharT);
+
+        std::size_t length = 0;
+        if (!std::is_constant_evaluated())
+        {
+            for (; length + chars_per_word <= size; length += chars_per_word)
+            {
+                std::uint64_t word;
+                std::memcpy(&word, first + length, sizeof(word));
+                if (detail::word_needs_escape<CharT>(word))
+                    break;
+            }
+        }
+        while (length < size && detail::is_printable_as_is(first[length]))
+            ++length;
+        return length;
     }
-    return bs::string{c};
 }
 
-constexpr auto char_to_printable_string(wchar_t c) -> bs::string
+template<string_sink Sink>
+constexpr void append_printable(Sink& sink, char c)
+{
+    if (auto const escape = detail::named_escape(c); !escape.empty())
+        sink.append(escape);
+    else if ((c > '\x00' && c < '\x1f') || c == '\x7f')
+        detail::append_hex_escape<2>(sink, static_cast<unsigned char>(c));
+    else
+        sink.push_back(c);
+}
+
+template<string_sink Sink>
+constexpr void append_printable(Sink& sink, wchar_t c)
+{
+    detail::append_hex_escape<8>(sink, static_cast<std::uint32_t>(c));
+}
+
+template<string_sink Sink>
+constexpr void append_printable(Sink& sink, char8_t c)
 {
-    auto const s = to_string<16, 8>(static_cast<std::uint32_t>(c));
-    return R"(\x)" + s;
+    append_printable(sink, static_cast<char>(c));
 }
 
-constexpr auto char_to_printable_string(char8_t c) -> bs::string
+template<string_sink Sink>
+constexpr void append_printable(Sink& sink, char16_t c)
 {
-    return char_to_printable_string(static_cast<char>(c));
+    if (c < 128u)
+        return append_printable(sink, static_cast<char>(c));
+    detail::append_hex_escape<4>(sink, static_cast<std::uint16_t>(c));
 }
 
-constexpr auto char_to_printable_string(char16_t c) -> bs::string
+template<string_sink Sink>
+constexpr void append_printable(Sink& sink, char32_t c)
 {
-    auto const i = static_cast<std::uint16_t>(c);
-    if (i < 128u)
-        return char_to_printable_string(static_cast<char>(c));
-    auto const s = to_string<16, 4>(i);
-    return R"(\x)" + s;
+    if (c < 128u)
+        return append_printable(sink, static_cast<char>(c));
+    detail::append_hex_escape<8>(sink, static_cast<std::uint32_t>(c));
 }
 
-constexpr auto char_to_printable_string(char32_t c) -> bs::string
+template<character CharT>
+constexpr auto char_to_printable_string(CharT c) -> bs::string
 {
-    auto const i = static_cast<std::uint32_t>(c);
-    if (i < 128u)
-        return char_to_printable_string(static_cast<char>(c));
-    auto const s = to_string<16, 8>(i);
-    return R"(\x)" + s;
+    bs::string result;
+    append_printable(result, c);
+    return result;
 }
 } // namespace bs
 
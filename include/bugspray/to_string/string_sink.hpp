@@ -0,0 +1,50 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef BUGSPRAY_STRING_SINK_HPP
+#define BUGSPRAY_STRING_SINK_HPP
+
+#include <string_view>
+
+/*
+ * A string_sink is anything stringification can write its output to, e.g. bs::string, std::string or a
+ * structural_buffer. Types can provide a format_to(sink, value) overload, found via ADL, to write their representation
+ * into the sink directly instead of returning a bs::string from to_string. stringify_to() picks the best way to
+ * stringify a value into a sink, see stringify.hpp.
+ */
+
+namespace bs
+{
+template<typename S>
+concept string_sink = requires(S& sink, std::string_view sv, char c)
+{
+    sink.append(sv);
+    sink.push_back(c);
+};
+
+template<string_sink Sink, typename T>
+constexpr void stringify_to(Sink& sink, T&& thing);
+} // namespace bs
+
+#endif // BUGSPRAY_STRING_SINK_HPP
@@ -34,23 +34,116 @@
 #include "bugspray/to_string/to_string_pair.hpp"
 #include "bugspray/to_string/to_string_pointer.hpp"
 #include "bugspray/to_string/to_string_string_like.hpp"
+#include "bugspray/to_string/string_sink.hpp"
+#include "bugspray/to_string/stringify_limits.hpp"
 #include "bugspray/to_string/to_string_tag.hpp"
 #include "bugspray/to_string/to_string_tuple.hpp"
 #include "bugspray/to_string/to_string_variant.hpp"
 #include "bugspray/utility/string.hpp"
 
-#include <sstream>
+#include <ios>
+#include <locale>
+#include <ostream>
+#include <streambuf>
+#include <string_view>
+#include <utility>
+
+#include <cstddef>
 
 namespace bs
 {
 namespace detail
 {
+/*
+ * A streambuf that appends everything written to it to the bs::string it currently targets, so stringify() can use
+ * operator<< without copying the result out of a stringstream.
+ */
+class string_appending_streambuf : public std::streambuf
+{
+  public:
+    auto exchange_target(bs::string* target) noexcept -> bs::string* { return std::exchange(m_target, target); }
+
+  protected:
+    auto overflow(int_type c) -> int_type override
+    {
+        if (traits_type::eq_int_type(c, traits_type::eof()))
+            return traits_type::not_eof(c);
+        m_target->push_back(traits_type::to_char_type(c));
+        return c;
+    }
+    auto xsputn(char const* s, std::streamsize count) -> std::streamsize override
+    {
+        m_target->append(std::string_view{s, static_cast<std::size_t>(count)});
+        return count;
+    }
+
+  private:
+    bs::string* m_target = nullptr;
+};
+
+/*
+ * Constructing a stream looks up the global locale and allocates, so every thread reuses a single stream. It is put
+ * back into the state of a newly constructed stream before each use, so formatting state or a locale left behind by an
+ * operator<< doesn't leak into the next one. Nested uses, i.e. an operator<< that stringifies other values, get a
+ * stream of their own so they don't disturb the formatting state of the outer one.
+ */
+struct reusable_stream
+{
+    string_appending_streambuf buffer;
+    std::ostream               stream{&buffer};
+    bool                       in_use = false;
+
+    void reset()
+    {
+        stream.exceptions(std::ios_base::goodbit);
+        stream.clear();
+        stream.flags(std::ios_base::skipws | std::ios_base::dec);
+        stream.precision(6);
+        stream.width(0);
+        stream.tie(nullptr);
+        // Cheaper than an unconditional imbue(), which recaches the facets even if nothing changed
+        if (std::locale const global; stream.getloc() != global)
+            stream.imbue(global);
+        stream.fill(stream.widen(' '));
+    }
+};
+
+inline auto thread_local_stream() -> reusable_stream&
+{
+    thread_local reusable_stream reusable;
+    return reusable;
+}
+
 template<typename T>
 auto stringify_using_ostream(T&& thing) -> bs::string
 {
-    std::ostringstream ss;
-    ss << std::forward<T>(thing);
-    return bs::string{ss.str()};
+    bs::string result;
+
+    auto& reusable = thread_local_stream();
+    if (reusable.in_use)
+    {
+        string_appending_streambuf buffer;
+        buffer.exchange_target(&result);
+        std::ostream stream{&buffer};
+        stream << std::forward<T>(thing);
+        return result;
+    }
+
+    struct release_on_exit
+    {
+        reusable_stream& reusable;
+        ~release_on_exit()
+        {
+            reusable.buffer.exchange_target(nullptr);
+            reusable.in_use = false;
+        }
+    } const release{reusable};
+
+    reusable.in_use = true;
+    reusable.reset();
+    reusable.buffer.exchange_target(&result);
+    reusable.stream << std::forward<T>(thing);
+    return result;
 }
 } // namespace detail
 
@@ -59,17 +152,41 @@ constexpr auto stringify(T&& thing) -> bs::string
 {
     if constexpr (requires { to_string(bs::to_string_override_tag{}, std::forward<T>(thing)); })
         return to_string(bs::to_string_override_tag{}, std::forward<T>(thing));
+    else if constexpr (requires(bounded_sink<bs::string>& sink) { format_to(sink, std::forward<T>(thing)); })
+    {
+        bs::string               result;
+        bounded_sink<bs::string> sink{result, current_stringify_limits().max_expansion_length};
+        format_to(sink, std::forward<T>(thing));
+        if (sink.truncated())
+            result += "...";
+        return result;
+    }
     else if constexpr (requires { to_string(std::forward<T>(thing)); })
         return to_string(std::forward<T>(thing));
     else if constexpr (requires { to_string(bs::to_string_tag{}, std::forward<T>(thing)); })
         return to_string(bs::to_string_tag{}, std::forward<T>(thing));
-    else if constexpr (requires(std::ostringstream& ss) { ss << std::forward<T>(thing); })
+    else if constexpr (requires(std::ostream& os) { os << std::forward<T>(thing); })
     {
         if (!std::is_constant_evaluated())
             return detail::stringify_using_ostream(std::forward<T>(thing));
     }
     return "<?>";
 }
+
+/*
+ * Writes the string representation of thing into sink, following the same cascade as stringify(). Types with a
+ * format_to(sink, thing) overload write into the sink directly, all others are stringified and appended.
+ */
+template<string_sink Sink, typename T>
+constexpr void stringify_to(Sink& sink, T&& thing)
+{
+    if constexpr (requires { to_string(bs::to_string_override_tag{}, std::forward<T>(thing)); })
+        sink.append(std::string_view{to_string(bs::to_string_override_tag{}, std::forward<T>(thing))});
+    else if constexpr (requires { format_to(sink, std::forward<T>(thing)); })
+        format_to(sink, std::forward<T>(thing));
+    else
+        sink.append(std::string_view{stringify(std::forward<T>(thing))});
+}
 } // namespace bs
 
 #endif // BUGSPRAY_STRINGIFY_HPP
@@ -0,0 +1,143 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef BUGSPRAY_STRINGIFY_LIMITS_HPP
+#define BUGSPRAY_STRINGIFY_LIMITS_HPP
+
+#include "bugspray/to_string/string_sink.hpp"
+#include "bugspray/to_string/to_string_integral.hpp"
+
+#include <algorithm>
+#include <string_view>
+#include <type_traits>
+
+#include <cstddef>
+
+/*
+ * Limits the size of stringified values, so failing assertions on huge values stay cheap to report. Stringifiers stop
+ * producing output once a limit is reached and mark the elided rest with "...(N more)". The runtime configuration is
+ * set up by the test runner from the command line. During constant evaluation, much smaller limits apply, since
+ * compilers bound the number of evaluation steps and failure messages are cut to 2048 characters anyway. They can be
+ * configured with the BUGSPRAY_COMPILE_EVAL_MAX_* macros below.
+ *
+ * Note: Don't store a single limit in a const integral variable. Its initializer would be manifestly constant
+ * evaluated, and always yield the default.
+ */
+
+#ifndef BUGSPRAY_COMPILE_EVAL_MAX_EXPANSION_LENGTH
+#define BUGSPRAY_COMPILE_EVAL_MAX_EXPANSION_LENGTH 1000
+#endif
+
+#ifndef BUGSPRAY_COMPILE_EVAL_MAX_CONTAINER_ELEMENTS
+#define BUGSPRAY_COMPILE_EVAL_MAX_CONTAINER_ELEMENTS 32
+#endif
+
+#ifndef BUGSPRAY_COMPILE_EVAL_MAX_STRING_LENGTH
+#define BUGSPRAY_COMPILE_EVAL_MAX_STRING_LENGTH 200
+#endif
+
+namespace bs
+{
+struct stringify_limits
+{
+    std::size_t max_expansion_length   = 100'000;
+    std::size_t max_container_elements = 10'000;
+    std::size_t max_string_length      = 10'000;
+};
+
+inline stringify_limits g_stringify_limits;
+
+inline constexpr stringify_limits compile_eval_stringify_limits{
+    .max_expansion_length   = BUGSPRAY_COMPILE_EVAL_MAX_EXPANSION_LENGTH,
+    .max_container_elements = BUGSPRAY_COMPILE_EVAL_MAX_CONTAINER_ELEMENTS,
+    .max_string_length      = BUGSPRAY_COMPILE_EVAL_MAX_STRING_LENGTH,
+};
+
+[[nodiscard]] constexpr auto current_stringify_limits() noexcept -> stringify_limits
+{
+    if (std::is_constant_evaluated())
+        return compile_eval_stringify_limits;
+    return g_stringify_limits;
+}
+
+template<string_sink Sink>
+constexpr void append_elision_marker(Sink& sink, std::size_t more)
+{
+    sink.append("...(");
+    sink.append(std::string_view{to_string(more)});
+    sink.append(" more)");
+}
+
+/*
+ * A string_sink that forwards to another sink until max_length characters were written, and drops everything after.
+ * Stringifiers of composite values check full() to stop early.
+ */
+template<string_sink Sink>
+class bounded_sink
+{
+  public:
+    constexpr bounded_sink(Sink& sink, std::size_t max_length) noexcept
+        : m_sink(sink)
+        , m_remaining(max_length)
+    {
+    }
+
+    constexpr void append(std::string_view sv)
+    {
+        auto const n = std::min(sv.size(), m_remaining);
+        m_sink.append(sv.substr(0, n));
+        m_remaining -= n;
+        m_truncated = m_truncated || n < sv.size();
+    }
+    constexpr void push_back(char c)
+    {
+        if (m_remaining > 0)
+        {
+            m_sink.push_back(c);
+            --m_remaining;
+        }
+        else
+            m_truncated = true;
+    }
+
+    [[nodiscard]] constexpr auto full() const noexcept -> bool { return m_remaining == 0; }
+    [[nodiscard]] constexpr auto truncated() const noexcept -> bool { return m_truncated; }
+
+  private:
+    Sink&       m_sink;
+    std::size_t m_remaining;
+    bool        m_truncated = false;
+};
+
+template<string_sink Sink>
+[[nodiscard]] constexpr auto sink_full(Sink const& sink) noexcept -> bool
+{
+    if constexpr (requires { sink.full(); })
+        return sink.full();
+    else
+        return false;
+}
+} // namespace bs
+
+#endif // BUGSPRAY_STRINGIFY_LIMITS_HPP
@@ -25,26 +25,48 @@
 #ifndef BUGSPRAY_TO_STRING_CONTAINER_HPP
 #define BUGSPRAY_TO_STRING_CONTAINER_HPP
 
+#include "bugspray/to_string/string_sink.hpp"
+#include "bugspray/to_string/stringify_limits.hpp"
+#include "bugspray/utility/character.hpp"
 #include "bugspray/utility/string.hpp"
 
 #include <ranges>
+#include <utility>
+
+#include <cstddef>
 
 namespace bs
 {
-template<typename T>
-constexpr auto stringify(T&& thing) -> bs::string;
+template<string_sink Sink, std::ranges::forward_range T>
+    requires(!character<std::ranges::range_value_t<T>>)
+constexpr void format_to(Sink& sink, T&& r)
+{
+    auto const limits = current_stringify_limits();
+
+    sink.append("{ ");
+    auto        iter  = std::ranges::begin(r);
+    auto const  end   = std::ranges::end(r);
+    std::size_t count = 0;
+    for (; iter != end && count < limits.max_container_elements && !sink_full(sink); ++iter, ++count)
+    {
+        if (count > 0)
+            sink.append(", ");
+        stringify_to(sink, *iter);
+    }
+    if (iter != end)
+    {
+        if (count > 0)
+            sink.append(", ");
+        append_elision_marker(sink, static_cast<std::size_t>(std::ranges::distance(iter, end)));
+    }
+    sink.append(" }");
+}
 
 template<std::ranges::forward_range T>
 constexpr auto to_string(T&& r) -> bs::string
 {
-    bs::string result = "{ ";
-    if (std::ranges::distance(r) > 0)
-    {
-        result += stringify(*std::begin(r));
-        for (auto iter = std::next(std::begin(r)); iter != std::end(r); ++iter)
-            result += ", " + stringify(*iter);
-    }
-    result += " }";
+    bs::string result;
+    format_to(result, std::forward<T>(r));
     return result;
 }
 } // namespace bs
@@ -25,49 +25,357 @@
 #ifndef BUGSPRAY_TO_STRING_FLOATING_POINT_HPP
 #define BUGSPRAY_TO_STRING_FLOATING_POINT_HPP
 
+#include "bugspray/to_string/to_string_integral.hpp"
+#include "bugspray/utility/detail/big_uint.hpp"
 #include "bugspray/utility/string.hpp"
 
+#include <algorithm>
 #include <array>
+#include <bit>
 #include <charconv>
 #include <concepts>
 #include <limits>
 #include <string_view>
 #include <type_traits>
-#include <utility>
 
-#include <cassert>
+#include <cstddef>
 #include <cstdint>
 
+/*
+ * Floating point values are formatted like std::to_chars without precision formats them: with the fewest digits that
+ * read back as the same value. The digits are found with exact integer arithmetic (Burger and Dybvig's free-format
+ * algorithm), which works during constant evaluation. The general format uses whichever of fixed and scientific
+ * notation is shorter, preferring fixed on ties, like std::to_chars without a format. At runtime, std::to_chars itself
+ * is used, since the exact arithmetic is several times slower.
+ */
+
 namespace bs
 {
 namespace detail
 {
-constexpr auto log10ceil(auto num) -> int
+// Large enough for the scaled value, its boundaries and the power of ten used to convert any value of T
+template<std::floating_point T>
+using float_big_uint = big_uint<(std::numeric_limits<T>::max_exponent - std::numeric_limits<T>::min_exponent
+                                 + 2 * std::numeric_limits<T>::digits + 64)
+                                    / 32
+                                + 1>;
+
+// |value| = mantissa * 2^exponent
+template<std::floating_point T>
+struct float_parts
+{
+    float_big_uint<T> mantissa;
+    int               exponent = 0;
+    // Whether the next smaller value is closer than the next larger one, which is the case for powers of two
+    bool lower_gap_is_smaller = false;
+};
+
+template<std::floating_point T>
+struct decimal_digits
 {
-    return num < 10 ? 1 : 1 + log10ceil(num / 10);
+    std::array<char, std::numeric_limits<T>::max_digits10 + 1> digits{};
+    std::size_t                                                 length = 0;
+    // value = 0.d1d2...dn * 10^exponent
+    int exponent = 0;
+
+    [[nodiscard]] constexpr auto view() const -> std::string_view { return {digits.data(), length}; }
+};
+
+template<std::floating_point T>
+constexpr auto pow2(int exponent) -> T
+{
+    T result = 1;
+    for (; exponent > 0; --exponent)
+        result *= 2;
+    return result;
 }
-} // namespace detail
 
-template<std::chars_format Format = std::chars_format::general, std::floating_point T>
-constexpr auto to_string(T f) -> bs::string
+template<std::floating_point T>
+constexpr auto is_negative(T f) -> bool
 {
-    if (std::is_constant_evaluated()) // TODO: Implement for constexpr evaluation
-        return "<?>";
+    if (f == f && f != 0)
+        return f < 0;
+    // long double has no portable bit representation, but converting zeros and NaNs to double keeps their sign
+    return (std::bit_cast<std::uint64_t>(static_cast<double>(f)) >> 63) != 0;
+}
+
+// Requires f to be finite and positive
+template<std::floating_point T>
+constexpr auto decompose(T f) -> float_parts<T>
+{
+    using limits = std::numeric_limits<T>;
+    // The exponent of the subnormal values
+    constexpr int min_exponent = limits::min_exponent - limits::digits;
+
+    if constexpr (limits::is_iec559
+                  && ((sizeof(T) == 4 && limits::digits == 24) || (sizeof(T) == 8 && limits::digits == 53)))
+    {
+        using bits_t = std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+
+        constexpr int fraction_bits   = limits::digits - 1;
+        auto const    bits            = std::bit_cast<bits_t>(f);
+        auto const    biased_exponent = static_cast<int>(bits >> fraction_bits);
+        auto const    fraction        = bits & ((bits_t{1} << fraction_bits) - 1);
+        if (biased_exponent == 0)
+            return {float_big_uint<T>{fraction}, min_exponent, false};
+        return {float_big_uint<T>{fraction | bits_t{1} << fraction_bits}, biased_exponent - 1 + min_exponent,
+                fraction == 0 && biased_exponent > 1};
+    }
     else
     {
-        constexpr auto length = []
+        // Without a known bit layout, f is scaled by powers of two into [top / 2, top), which is exact
+        constexpr T top  = pow2<T>(limits::digits);
+        constexpr T step = pow2<T>(32);
+
+        int exponent = 0;
+        for (; f >= top * step; f /= step)
+            exponent += 32;
+        for (; f >= top; f /= 2)
+            ++exponent;
+        for (; f * step < top / 2 && exponent - 32 >= min_exponent; f *= step)
+            exponent -= 32;
+        for (; f < top / 2 && exponent > min_exponent; f *= 2)
+            --exponent;
+
+        float_parts<T> result{{}, exponent, f == top / 2 && exponent > min_exponent};
+        for (int shift = (limits::digits - 1) / 32 * 32; shift >= 0; shift -= 32)
         {
-            if constexpr (Format == std::chars_format::scientific || Format == std::chars_format::general)
-                return 4 + std::numeric_limits<T>::max_digits10
-                       + std::max(2, detail::log10ceil(std::numeric_limits<T>::max_exponent10));
-            else if constexpr (Format == std::chars_format::fixed || Format == std::chars_format::hex)
-                return 2 + std::numeric_limits<T>::max_exponent10 + std::numeric_limits<T>::max_digits10;
-        }();
-        std::array<char, length> digits{};
-        auto [ptr, ec] = std::to_chars(digits.data(), digits.data() + length, f, Format);
-        assert(ec == std::errc());
-        return bs::string{std::string_view{digits.data(), ptr}};
+            auto const scale = pow2<T>(shift);
+            auto const limb  = static_cast<std::uint32_t>(f / scale);
+            f -= static_cast<T>(limb) * scale;
+            result.mantissa <<= 32;
+            result.mantissa += float_big_uint<T>{limb};
+        }
+        return result;
+    }
+}
+
+// Burger and Dybvig's free-format algorithm. Requires f to be finite and positive.
+template<std::floating_point T>
+constexpr auto shortest_decimal(T f) -> decimal_digits<T>
+{
+    auto const [mantissa, exponent, lower_gap_is_smaller] = decompose(f);
+
+    // Values halfway between f and its neighbours read back as f if its mantissa is even (round half to even)
+    bool const inclusive         = mantissa.is_even();
+    auto const shift             = lower_gap_is_smaller ? 2u : 1u;
+    auto const positive_exponent = static_cast<std::size_t>(std::max(exponent, 0));
+    auto const negative_exponent = static_cast<std::size_t>(std::max(-exponent, 0));
+
+    // f = r / s, the halfway points to its neighbours are (r - m_minus) / s and (r + m_plus) / s
+    auto r       = mantissa << (positive_exponent + shift);
+    auto s       = float_big_uint<T>{1} << (negative_exponent + shift);
+    auto m_minus = float_big_uint<T>{1} << positive_exponent;
+    auto m_plus  = m_minus << (lower_gap_is_smaller ? 1u : 0u);
+
+    // 78913 / 2^18 is slightly below log10(2), so the estimate is never too large and only needs to be fixed upwards
+    int  k       = (exponent + static_cast<int>(mantissa.bit_width()) - 1) * 78913 >> 18;
+    auto reaches = [&](auto const& remainder)
+    {
+        auto const order = compare_sum(remainder, m_plus, s);
+        return inclusive ? order >= 0 : order > 0;
+    };
+    if (k >= 0)
+        s.multiply_pow10(static_cast<std::size_t>(k));
+    else
+    {
+        r.multiply_pow10(static_cast<std::size_t>(-k));
+        m_minus.multiply_pow10(static_cast<std::size_t>(-k));
+        m_plus.multiply_pow10(static_cast<std::size_t>(-k));
+    }
+    for (; reaches(r); ++k)
+        s *= 10;
+
+    // With the top bit of s at the top of a limb, divide_small_quotient estimates each digit almost exactly
+    auto const alignment = (32 - s.bit_width() % 32) % 32;
+    r <<= alignment;
+    s <<= alignment;
+    m_minus <<= alignment;
+    m_plus <<= alignment;
+
+    decimal_digits<T> result;
+    result.exponent = k;
+    while (true)
+    {
+        r *= 10;
+        m_minus *= 10;
+        m_plus *= 10;
+        auto       digit = r.divide_small_quotient(s);
+        bool const low   = inclusive ? r <= m_minus : r < m_minus;
+        bool const high  = reaches(r);
+        if (low && high)
+        {
+            // Both digit and digit + 1 read back as f, take the closer one
+            auto const order = (r << 1) <=> s;
+            if (order > 0 || (order == 0 && digit % 2 != 0))
+                ++digit;
+        }
+        else if (high)
+            ++digit;
+        result.digits[result.length++] = static_cast<char>('0' + digit);
+        if (low || high)
+            return result;
+    }
+}
+
+// Appends all digits of the integral value f with decimal exponent k, which are more than its shortest digits
+template<std::floating_point T>
+constexpr void append_integral_digits(bs::string& out, T f, int k)
+{
+    auto const parts = decompose(f);
+
+    auto r = parts.mantissa << static_cast<std::size_t>(std::max(parts.exponent, 0));
+    auto s = float_big_uint<T>{1} << static_cast<std::size_t>(std::max(-parts.exponent, 0));
+    s.multiply_pow10(static_cast<std::size_t>(k - 1));
+    for (bool leading = true; k > 0; --k)
+    {
+        // The shortest digits may have rounded up to the next power of ten, then the exact value has one digit less
+        auto const digit = r.divide_small_quotient(s);
+        if (digit != 0 || !leading)
+            out += static_cast<char>('0' + digit);
+        leading = false;
+        r *= 10;
+    }
+}
+
+template<std::floating_point T>
+constexpr void append_fixed(bs::string& out, T f, decimal_digits<T> const& decimal)
+{
+    auto const digits   = decimal.view();
+    auto const exponent = decimal.exponent;
+    if (exponent <= 0)
+    {
+        out += "0.";
+        for (int i = exponent; i < 0; ++i)
+            out += '0';
+        out += digits;
+    }
+    else if (static_cast<std::size_t>(exponent) < digits.size())
+    {
+        out += digits.substr(0, static_cast<std::size_t>(exponent));
+        out += '.';
+        out += digits.substr(static_cast<std::size_t>(exponent));
+    }
+    else // Trailing zeros would be less precise than the exact value
+        append_integral_digits(out, f, exponent);
+}
+
+template<std::floating_point T>
+constexpr void append_scientific(bs::string& out, decimal_digits<T> const& decimal)
+{
+    auto const digits = decimal.view();
+    out += digits[0];
+    if (digits.size() > 1)
+    {
+        out += '.';
+        out += digits.substr(1);
     }
+    auto const exponent = decimal.exponent - 1;
+    out += exponent < 0 ? "e-" : "e+";
+    out += to_string<10, 2>(exponent < 0 ? -exponent : exponent);
+}
+
+template<std::floating_point T>
+constexpr auto fixed_length(decimal_digits<T> const& decimal) -> std::size_t
+{
+    if (decimal.exponent <= 0)
+        return 2 + static_cast<std::size_t>(-decimal.exponent) + decimal.length;
+    if (static_cast<std::size_t>(decimal.exponent) < decimal.length)
+        return decimal.length + 1;
+    return static_cast<std::size_t>(decimal.exponent);
+}
+
+template<std::floating_point T>
+constexpr auto scientific_length(decimal_digits<T> const& decimal) -> std::size_t
+{
+    auto const exponent        = decimal.exponent - 1 < 0 ? 1 - decimal.exponent : decimal.exponent - 1;
+    auto const exponent_digits = exponent >= 1000 ? 4u : exponent >= 100 ? 3u : 2u;
+    return decimal.length + (decimal.length > 1 ? 1 : 0) + 2 + exponent_digits;
+}
+
+// Like printf's %a without the 0x prefix, with trailing zeros removed
+template<std::floating_point T>
+constexpr void append_hex(bs::string& out, T f)
+{
+    constexpr int         fraction_bits = std::numeric_limits<T>::digits - 1;
+    constexpr std::size_t hex_digits    = (fraction_bits + 3) / 4;
+
+    auto const parts  = decompose(f);
+    bool const normal = parts.mantissa.bit_width() == static_cast<std::size_t>(std::numeric_limits<T>::digits);
+
+    std::array<char, hex_digits> digits{};
+    std::size_t                  length = 0;
+    for (std::size_t i = 0; i < hex_digits; ++i)
+    {
+        unsigned   nibble = 0;
+        auto const top    = fraction_bits - 1 - 4 * static_cast<int>(i);
+        for (int bit = top; bit > top - 4; --bit)
+            nibble = nibble << 1 | (bit >= 0 && parts.mantissa.bit(static_cast<std::size_t>(bit)) ? 1u : 0u);
+        digits[i] = g_digits[nibble];
+        if (nibble != 0)
+            length = i + 1;
+    }
+
+    out += normal ? '1' : '0';
+    if (length > 0)
+    {
+        out += '.';
+        out += std::string_view{digits.data(), length};
+    }
+    auto const binary_exponent = normal ? parts.exponent + fraction_bits : std::numeric_limits<T>::min_exponent - 1;
+    out += binary_exponent < 0 ? "p-" : "p+";
+    out += to_string(binary_exponent < 0 ? -binary_exponent : binary_exponent);
+}
+
+// Formats f with exact integer arithmetic, which also works during constant evaluation
+template<std::chars_format Format, std::floating_point T>
+constexpr auto to_string_exact(T f) -> bs::string
+{
+    bs::string result;
+    if (is_negative(f))
+        result += '-';
+    if (f != f)
+        result += "nan";
+    else if (f == std::numeric_limits<T>::infinity() || f == -std::numeric_limits<T>::infinity())
+        result += "inf";
+    else if (f == 0)
+        result += Format == std::chars_format::hex ? "0p+0" : Format == std::chars_format::scientific ? "0e+00" : "0";
+    else if constexpr (Format == std::chars_format::hex)
+        append_hex(result, f < 0 ? -f : f);
+    else
+    {
+        auto const magnitude = f < 0 ? -f : f;
+        auto const decimal   = shortest_decimal(magnitude);
+        if (Format == std::chars_format::scientific
+            || (Format == std::chars_format::general && scientific_length(decimal) < fixed_length(decimal)))
+            append_scientific(result, decimal);
+        else
+            append_fixed(result, magnitude, decimal);
+    }
+    return result;
+}
+
+// Fits the sign, the fixed notation of the smallest subnormal value and the digits of the largest value
+template<std::floating_point T>
+inline constexpr std::size_t max_float_length =
+    3 + std::numeric_limits<T>::max_digits10
+    + std::max(std::numeric_limits<T>::max_exponent10,
+               std::numeric_limits<T>::digits10 + 1 - std::numeric_limits<T>::min_exponent10);
+} // namespace detail
+
+template<std::chars_format Format = std::chars_format::general, std::floating_point T>
+constexpr auto to_string(T f) -> bs::string
+{
+    if (std::is_constant_evaluated())
+        return detail::to_string_exact<Format>(f);
+
+    std::array<char, detail::max_float_length<T>> buffer{};
+    auto const [ptr, ec] = Format == std::chars_format::general
+                               ? std::to_chars(buffer.data(), buffer.data() + buffer.size(), f)
+                               : std::to_chars(buffer.data(), buffer.data() + buffer.size(), f, Format);
+    if (ec != std::errc())
+        return detail::to_string_exact<Format>(f);
+    return bs::string{std::string_view{buffer.data(), ptr}};
 }
 } // namespace bs
 
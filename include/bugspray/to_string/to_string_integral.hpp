@@ -29,10 +29,14 @@
 
 #include <algorithm>
 #include <array>
+#include <bit>
 #include <concepts>
+#include <limits>
+#include <string_view>
 #include <type_traits>
 #include <utility>
 
+#include <cstddef>
 #include <cstdint>
 
 namespace bs
@@ -41,26 +45,80 @@ static constexpr std::array g_digits{'0', '1', '2', '3', '4', '5', '6', '7', '8'
                                      'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n',
                                      'o', 'p', 'q', 'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z'};
 
+namespace detail
+{
+// "00", "01", ..., "99", to emit two decimal digits per division
+inline constexpr auto g_digit_pairs = []
+{
+    std::array<char, 200> result{};
+    for (std::size_t i = 0; i < 100; ++i)
+    {
+        result[2 * i]     = static_cast<char>('0' + i / 10);
+        result[2 * i + 1] = static_cast<char>('0' + i % 10);
+    }
+    return result;
+}();
+
+template<unsigned Base>
+constexpr auto max_digits() noexcept -> std::size_t
+{
+    std::size_t digits = 1;
+    for (auto n = std::numeric_limits<std::uintmax_t>::max(); n >= Base; n /= Base)
+        ++digits;
+    return digits;
+}
+} // namespace detail
+
 template<unsigned Base = 10, unsigned MinDigits = 0>
 constexpr auto to_string(std::integral auto i) -> bs::string
 {
     static_assert(Base > 1 && Base < 37, "Base must be in the range of [2, 36]");
 
-    bs::string     result;
+    // Digits are written back to front into a buffer large enough for any value, its padding and the sign
+    constexpr std::size_t         buffer_size = std::max<std::size_t>(detail::max_digits<Base>(), MinDigits) + 1;
+    std::array<char, buffer_size> buffer{};
+    std::size_t                   pos = buffer_size;
+
     bool const     neg = std::cmp_less(i, 0);
     std::uintmax_t n   = neg ? static_cast<std::uintmax_t>(-(i + 1)) + 1 : i;
-    do
+    if constexpr (Base == 10)
     {
-        auto const r = n % Base;
-        result.push_back(g_digits[r]);
-        n /= Base;
-    } while (n != 0);
-    while (result.size() < MinDigits)
-        result.push_back('0');
+        for (; n >= 100; n /= 100)
+        {
+            auto const idx = 2 * (n % 100);
+            buffer[--pos]  = detail::g_digit_pairs[idx + 1];
+            buffer[--pos]  = detail::g_digit_pairs[idx];
+        }
+        if (n >= 10)
+        {
+            buffer[--pos] = detail::g_digit_pairs[2 * n + 1];
+            buffer[--pos] = detail::g_digit_pairs[2 * n];
+        }
+        else
+            buffer[--pos] = g_digits[n];
+    }
+    else if constexpr (std::has_single_bit(Base))
+    {
+        constexpr auto shift = std::countr_zero(Base);
+        do
+        {
+            buffer[--pos] = g_digits[n & (Base - 1)];
+            n >>= shift;
+        } while (n != 0);
+    }
+    else
+    {
+        do
+        {
+            buffer[--pos] = g_digits[n % Base];
+            n /= Base;
+        } while (n != 0);
+    }
+    while (buffer_size - pos < MinDigits)
+        buffer[--pos] = '0';
     if (neg)
-        result.push_back('-');
-    std::ranges::reverse(result);
-    return result;
+        buffer[--pos] = '-';
+    return bs::string{std::string_view{buffer.data() + pos, buffer_size - pos}};
 }
 
 template<unsigned Base = 10, unsigned MinDigits = 0, std::integral T, T value>
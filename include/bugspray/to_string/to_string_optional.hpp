@@ -25,6 +25,7 @@
 #ifndef BUGSPRAY_TO_STRING_OPTIONAL_HPP
 #define BUGSPRAY_TO_STRING_OPTIONAL_HPP
 
+#include "bugspray/to_string/string_sink.hpp"
 #include "bugspray/utility/string.hpp"
 
 #include <ranges>
@@ -32,18 +33,22 @@
 
 namespace bs
 {
-template<typename T>
-constexpr auto stringify(T&& thing) -> bs::string;
+template<string_sink Sink, typename T>
+constexpr void format_to(Sink& sink, std::optional<T> const& r)
+{
+    sink.append("{ ");
+    if (r)
+        stringify_to(sink, *r);
+    else
+        sink.append("nullopt");
+    sink.append(" }");
+}
 
 template<typename T>
 constexpr auto to_string(std::optional<T> const& r) -> bs::string
 {
-    bs::string result = "{ ";
-    if (r)
-        result += stringify(*r);
-    else
-        result += "nullopt";
-    result += " }";
+    bs::string result;
+    format_to(result, r);
     return result;
 }
 } // namespace bs
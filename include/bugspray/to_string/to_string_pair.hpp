@@ -25,23 +25,28 @@
 #ifndef BUGSPRAY_TO_STRING_PAIR_HPP
 #define BUGSPRAY_TO_STRING_PAIR_HPP
 
+#include "bugspray/to_string/string_sink.hpp"
 #include "bugspray/utility/string.hpp"
 
 #include <utility>
 
 namespace bs
 {
-template<typename T>
-constexpr auto stringify(T&& thing) -> bs::string;
+template<string_sink Sink, typename T, typename U>
+constexpr void format_to(Sink& sink, std::pair<T, U> const& p)
+{
+    sink.append("{ ");
+    stringify_to(sink, p.first);
+    sink.append(", ");
+    stringify_to(sink, p.second);
+    sink.append(" }");
+}
 
 template<typename T, typename U>
 constexpr auto to_string(std::pair<T, U> const& p) -> bs::string
 {
-    bs::string result = "{ ";
-    result += stringify(p.first);
-    result += ", ";
-    result += stringify(p.second);
-    result += " }";
+    bs::string result;
+    format_to(result, p);
     return result;
 }
 } // namespace bs
@@ -26,30 +26,106 @@
 #define BUGSPRAY_TO_STRING_STRING_LIKE_HPP
 
 #include "bugspray/to_string/char_to_printable_string.hpp"
+#include "bugspray/to_string/string_sink.hpp"
+#include "bugspray/to_string/stringify_limits.hpp"
 #include "bugspray/utility/character.hpp"
 #include "bugspray/utility/string.hpp"
 
+#include <algorithm>
+#include <array>
 #include <ranges>
+#include <string_view>
+#include <utility>
+
+#include <cstddef>
 
 namespace bs
 {
+namespace detail
+{
+// Appends characters that are printable as they are, see printable_prefix_length()
+template<string_sink Sink, character CharT>
+constexpr void append_as_is(Sink& sink, CharT const* first, std::size_t count)
+{
+    if constexpr (std::same_as<CharT, char>)
+        sink.append(std::string_view{first, count});
+    else
+    {
+        std::array<char, 256> buffer{};
+        while (count > 0)
+        {
+            auto const chunk = std::min(count, buffer.size());
+            std::transform(first, first + chunk, buffer.begin(), [](CharT c) { return static_cast<char>(c); });
+            sink.append(std::string_view{buffer.data(), chunk});
+            first += chunk;
+            count -= chunk;
+        }
+    }
+}
+} // namespace detail
+
+template<string_sink Sink, std::ranges::forward_range T>
+    requires character<std::ranges::range_value_t<T>>
+constexpr void format_to(Sink& sink, T&& s)
+{
+    auto const limits = current_stringify_limits();
+
+    sink.push_back('"');
+    if constexpr (std::ranges::contiguous_range<T> && std::ranges::sized_range<T>)
+    {
+        // Runs of characters without escapes are copied in bulk
+        auto const* const data   = std::ranges::data(s);
+        auto const        size   = static_cast<std::size_t>(std::ranges::size(s));
+        auto const        length = std::min(size, limits.max_string_length);
+        for (std::size_t pos = 0; pos < length && !sink_full(sink);)
+        {
+            auto const run = printable_prefix_length(data + pos, length - pos);
+            detail::append_as_is(sink, data + pos, run);
+            pos += run;
+            if (pos < length)
+                append_printable(sink, data[pos++]);
+        }
+        sink.push_back('"');
+        if (size > length)
+            append_elision_marker(sink, size - length);
+    }
+    else
+    {
+        auto        iter  = std::ranges::begin(s);
+        auto const  end   = std::ranges::end(s);
+        std::size_t count = 0;
+        for (; iter != end && count < limits.max_string_length && !sink_full(sink); ++iter, ++count)
+            append_printable(sink, *iter);
+        sink.push_back('"');
+        if (iter != end)
+            append_elision_marker(sink, static_cast<std::size_t>(std::ranges::distance(iter, end)));
+    }
+}
+
+template<string_sink Sink, character CharT>
+constexpr void format_to(Sink& sink, CharT const* s)
+{
+    if (s == nullptr)
+        sink.append("nullptr");
+    else
+        format_to(sink, std::basic_string_view<CharT>{s});
+}
+
 template<std::ranges::forward_range T>
 constexpr auto to_string(T&& s) -> bs::string
     requires character<std::ranges::range_value_t<T>>
 {
-    bs::string result = "\"";
-    for (auto&& c : s)
-        result += char_to_printable_string(c);
-    result += "\"";
+    bs::string result;
+    format_to(result, std::forward<T>(s));
     return result;
 }
 
 template<character CharT>
 constexpr auto to_string(CharT const* s) -> bs::string
 {
-    if (s == nullptr)
-        return "nullptr";
-    return to_string(std::basic_string_view<CharT>{s});
+    bs::string result;
+    format_to(result, s);
+    return result;
 }
 } // namespace bs
 
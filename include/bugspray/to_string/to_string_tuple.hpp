@@ -25,6 +25,7 @@
 #ifndef BUGSPRAY_TO_STRING_TUPLE_HPP
 #define BUGSPRAY_TO_STRING_TUPLE_HPP
 
+#include "bugspray/to_string/string_sink.hpp"
 #include "bugspray/utility/static_for.hpp"
 #include "bugspray/utility/string.hpp"
 
@@ -32,22 +33,30 @@
 
 namespace bs
 {
-template<typename T>
-constexpr auto stringify(T&& thing) -> bs::string;
-
-template<typename... Ts>
-constexpr auto to_string(std::tuple<Ts...> const& t) -> bs::string
+template<string_sink Sink, typename... Ts>
+constexpr void format_to(Sink& sink, std::tuple<Ts...> const& t)
 {
-    bs::string result = "{ ";
-
+    sink.append("{ ");
     if constexpr (sizeof...(Ts) > 0)
     {
-        result += stringify(std::get<0>(t));
-        static_for<1, sizeof...(Ts)>([&](auto I) { result += ", " + stringify(std::get<I>(t)); });
-        result += " }";
+        stringify_to(sink, std::get<0>(t));
+        static_for<1, sizeof...(Ts)>(
+            [&](auto I)
+            {
+                sink.append(", ");
+                stringify_to(sink, std::get<I>(t));
+            });
+        sink.append(" }");
     }
     else
-        result += "}";
+        sink.append("}");
+}
+
+template<typename... Ts>
+constexpr auto to_string(std::tuple<Ts...> const& t) -> bs::string
+{
+    bs::string result;
+    format_to(result, t);
     return result;
 }
 } // namespace bs
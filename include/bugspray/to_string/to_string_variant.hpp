@@ -25,6 +25,7 @@
 #ifndef BUGSPRAY_TO_STRING_VARIANT_HPP
 #define BUGSPRAY_TO_STRING_VARIANT_HPP
 
+#include "bugspray/to_string/string_sink.hpp"
 #include "bugspray/utility/string.hpp"
 
 #include <ranges>
@@ -32,15 +33,19 @@
 
 namespace bs
 {
-template<typename T>
-constexpr auto stringify(T&& thing) -> bs::string;
+template<string_sink Sink, typename... Ts>
+constexpr void format_to(Sink& sink, std::variant<Ts...> const& r)
+{
+    sink.append("{ ");
+    std::visit([&sink](auto&& v) { stringify_to(sink, v); }, r);
+    sink.append(" }");
+}
 
 template<typename... Ts>
 constexpr auto to_string(std::variant<Ts...> const& r) -> bs::string
 {
-    bs::string result = "{ ";
-    std::visit([&result](auto&& v) { result += stringify(v); }, r);
-    result += " }";
+    bs::string result;
+    format_to(result, r);
     return result;
 }
 } // namespace bs
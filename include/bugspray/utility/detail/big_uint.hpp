@@ -0,0 +1,244 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef BUGSPRAY_BIG_UINT_HPP
+#define BUGSPRAY_BIG_UINT_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <compare>
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+/*
+ * big_uint is an unsigned integer of fixed capacity, stored as little endian array of 32 bit limbs. It implements just
+ * the operations needed for exact floating point to decimal conversion, and all of them are constexpr. Overflowing
+ * the capacity is a precondition violation.
+ */
+
+namespace bs::detail
+{
+template<std::size_t Limbs>
+class big_uint
+{
+  public:
+    constexpr big_uint() = default;
+    constexpr explicit big_uint(std::uint64_t value)
+    {
+        for (; value != 0; value >>= 32)
+            m_limbs[m_size++] = static_cast<std::uint32_t>(value);
+    }
+
+    [[nodiscard]] constexpr auto is_zero() const -> bool { return m_size == 0; }
+    [[nodiscard]] constexpr auto is_even() const -> bool { return m_size == 0 || m_limbs[0] % 2 == 0; }
+    [[nodiscard]] constexpr auto bit_width() const -> std::size_t
+    {
+        return m_size == 0 ? 0 : 32 * (m_size - 1) + static_cast<std::size_t>(std::bit_width(m_limbs[m_size - 1]));
+    }
+    [[nodiscard]] constexpr auto bit(std::size_t index) const -> bool
+    {
+        return index / 32 < m_size && (m_limbs[index / 32] >> (index % 32) & 1u) != 0;
+    }
+
+    constexpr auto operator+=(big_uint const& other) -> big_uint&
+    {
+        auto const    size  = std::max(m_size, other.m_size);
+        std::uint64_t carry = 0;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            carry += std::uint64_t{m_limbs[i]} + other.m_limbs[i];
+            m_limbs[i] = static_cast<std::uint32_t>(carry);
+            carry >>= 32;
+        }
+        m_size = size;
+        if (carry != 0)
+            push_limb(static_cast<std::uint32_t>(carry));
+        return *this;
+    }
+
+    // Requires *this >= other
+    constexpr auto operator-=(big_uint const& other) -> big_uint&
+    {
+        assert(*this >= other);
+        std::int64_t borrow = 0;
+        for (std::size_t i = 0; i < m_size; ++i)
+        {
+            borrow += std::int64_t{m_limbs[i]} - other.m_limbs[i];
+            m_limbs[i] = static_cast<std::uint32_t>(borrow);
+            borrow     = borrow < 0 ? -1 : 0;
+        }
+        trim();
+        return *this;
+    }
+
+    constexpr auto operator*=(std::uint32_t factor) -> big_uint&
+    {
+        std::uint64_t carry = 0;
+        for (std::size_t i = 0; i < m_size; ++i)
+        {
+            carry += std::uint64_t{m_limbs[i]} * factor;
+            m_limbs[i] = static_cast<std::uint32_t>(carry);
+            carry >>= 32;
+        }
+        if (carry != 0)
+            push_limb(static_cast<std::uint32_t>(carry));
+        if (factor == 0)
+            clear();
+        return *this;
+    }
+
+    constexpr auto operator<<=(std::size_t shift) -> big_uint&
+    {
+        if (m_size == 0 || shift == 0)
+            return *this;
+        auto const limb_shift = shift / 32;
+        auto const bit_shift  = static_cast<unsigned>(shift % 32);
+        assert(m_size + limb_shift <= Limbs);
+        if (bit_shift == 0)
+        {
+            for (std::size_t i = m_size; i-- > 0;)
+                m_limbs[i + limb_shift] = m_limbs[i];
+        }
+        else
+        {
+            auto const carry = m_limbs[m_size - 1] >> (32 - bit_shift);
+            if (carry != 0)
+            {
+                assert(m_size + limb_shift < Limbs);
+                m_limbs[m_size + limb_shift] = carry;
+            }
+            for (std::size_t i = m_size; i-- > 0;)
+                m_limbs[i + limb_shift] = m_limbs[i] << bit_shift | (i > 0 ? m_limbs[i - 1] >> (32 - bit_shift) : 0u);
+            m_size += carry != 0 ? 1 : 0;
+        }
+        std::fill_n(m_limbs.begin(), limb_shift, 0u);
+        m_size += limb_shift;
+        return *this;
+    }
+
+    constexpr auto multiply_pow10(std::size_t exponent) -> big_uint&
+    {
+        for (; exponent >= 9; exponent -= 9)
+            *this *= 1'000'000'000u;
+        constexpr std::array<std::uint32_t, 9> small_powers{1, 10, 100, 1'000, 10'000, 100'000, 1'000'000, 10'000'000,
+                                                            100'000'000};
+        return *this *= small_powers[exponent];
+    }
+
+    // Replaces *this by the remainder of the division by divisor and returns the quotient, which has to fit into a
+    // limb. The quotient is estimated from the top limbs, which is at most one too small if the top bit of the divisor
+    // is the top bit of a limb.
+    constexpr auto divide_small_quotient(big_uint const& divisor) -> std::uint32_t
+    {
+        assert(!divisor.is_zero());
+        auto const size = divisor.m_size;
+        if (m_size < size)
+            return 0;
+        auto const top      = (size < Limbs ? std::uint64_t{m_limbs[size]} << 32 : 0) | m_limbs[size - 1];
+        auto       quotient = static_cast<std::uint32_t>(top / (std::uint64_t{divisor.m_limbs[size - 1]} + 1));
+        subtract_multiple(divisor, quotient);
+        for (; *this >= divisor; ++quotient)
+            *this -= divisor;
+        return quotient;
+    }
+
+    friend constexpr auto operator+(big_uint lhs, big_uint const& rhs) -> big_uint { return lhs += rhs; }
+    friend constexpr auto operator<<(big_uint lhs, std::size_t shift) -> big_uint { return lhs <<= shift; }
+
+    friend constexpr auto operator==(big_uint const& lhs, big_uint const& rhs) -> bool
+    {
+        return lhs.m_size == rhs.m_size && std::equal(lhs.m_limbs.begin(), lhs.m_limbs.begin() + lhs.m_size,
+                                                      rhs.m_limbs.begin());
+    }
+    friend constexpr auto operator<=>(big_uint const& lhs, big_uint const& rhs) -> std::strong_ordering
+    {
+        if (lhs.m_size != rhs.m_size)
+            return lhs.m_size <=> rhs.m_size;
+        for (std::size_t i = lhs.m_size; i-- > 0;)
+            if (lhs.m_limbs[i] != rhs.m_limbs[i])
+                return lhs.m_limbs[i] <=> rhs.m_limbs[i];
+        return std::strong_ordering::equal;
+    }
+
+    // Compares lhs + rhs to other, without materializing the sum
+    friend constexpr auto compare_sum(big_uint const& lhs, big_uint const& rhs, big_uint const& other)
+        -> std::strong_ordering
+    {
+        auto const    size   = std::max({lhs.m_size, rhs.m_size, other.m_size});
+        auto          result = std::strong_ordering::equal;
+        std::uint64_t carry  = 0;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            carry += std::uint64_t{lhs.m_limbs[i]} + rhs.m_limbs[i];
+            auto const limb = static_cast<std::uint32_t>(carry);
+            carry >>= 32;
+            if (limb != other.m_limbs[i])
+                result = limb <=> other.m_limbs[i];
+        }
+        return carry != 0 ? std::strong_ordering::greater : result;
+    }
+
+  private:
+    // Requires *this >= other * factor
+    constexpr void subtract_multiple(big_uint const& other, std::uint32_t factor)
+    {
+        std::uint64_t carry  = 0;
+        std::uint32_t borrow = 0;
+        for (std::size_t i = 0; i < m_size; ++i)
+        {
+            carry += std::uint64_t{other.m_limbs[i]} * factor;
+            auto const subtrahend = static_cast<std::uint32_t>(carry);
+            auto const limb       = m_limbs[i];
+            carry >>= 32;
+            m_limbs[i] = limb - subtrahend - borrow;
+            borrow     = limb < subtrahend || limb - subtrahend < borrow ? 1 : 0;
+        }
+        trim();
+    }
+    constexpr void push_limb(std::uint32_t limb)
+    {
+        assert(m_size < Limbs);
+        m_limbs[m_size++] = limb;
+    }
+    constexpr void trim()
+    {
+        while (m_size > 0 && m_limbs[m_size - 1] == 0)
+            --m_size;
+    }
+    constexpr void clear()
+    {
+        std::fill_n(m_limbs.begin(), m_size, 0u);
+        m_size = 0;
+    }
+
+    // Limbs beyond m_size are always zero
+    std::array<std::uint32_t, Limbs> m_limbs{};
+    std::size_t                      m_size = 0;
+};
+} // namespace bs::detail
+
+#endif // BUGSPRAY_BIG_UINT_HPP
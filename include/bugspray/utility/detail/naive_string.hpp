@@ -25,14 +25,25 @@
 #ifndef BUGSPRAY_NAIVE_STRING_HPP
 #define BUGSPRAY_NAIVE_STRING_HPP
 
-#include "bugspray/utility/vector.hpp"
-
+#include <algorithm>
+#include <compare>
+#include <iterator>
+#include <limits>
+#include <memory>
 #include <ostream>
+#include <stdexcept>
 #include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <cstdint>
 
 /*
  * Implements a subset of the functionality of std::string. This is meant as a stopgap solution while many stdlibs don't
  * yet fully support constexpr string.
+ *
+ * Strings of up to inline_capacity characters are stored within the object itself, longer strings on the heap. The
+ * storage always holds a terminating '\0' after the last character.
  */
 
 namespace bs
@@ -40,14 +51,16 @@ namespace bs
 class naive_string
 {
   public:
-    using value_type      = bs::vector<char>::value_type;
-    using reference       = bs::vector<char>::reference;
-    using const_reference = bs::vector<char>::const_reference;
-    using pointer         = bs::vector<char>::pointer;
-    using const_pointer   = bs::vector<char>::const_pointer;
-    using iterator        = bs::vector<char>::iterator;
-    using const_iterator  = bs::vector<char>::const_iterator;
-    using difference_type = bs::vector<char>::difference_type;
+    using value_type      = char;
+    using reference       = char&;
+    using const_reference = char const&;
+    using pointer         = char*;
+    using const_pointer   = char const*;
+    using iterator        = char*;
+    using const_iterator  = char const*;
+    using difference_type = std::ptrdiff_t;
+
+    static constexpr std::size_t inline_capacity = 15;
 
     constexpr naive_string() noexcept = default;
     constexpr naive_string(char c) { push_back(c); }
@@ -55,25 +68,44 @@ class naive_string
         : naive_string(std::string_view{str})
     {
     }
-    constexpr explicit naive_string(std::string_view sv)
+    constexpr explicit naive_string(std::string_view sv) { append(sv); }
+
+    constexpr naive_string(naive_string const& other) { append(other); }
+    constexpr naive_string(naive_string&& other) noexcept { take(other); }
+
+    constexpr ~naive_string() noexcept { release(); }
+
+    constexpr auto operator=(naive_string const& other) -> naive_string&
     {
-        for (auto c : sv)
-            push_back(c);
+        if (this != &other)
+        {
+            clear();
+            append(other);
+        }
+        return *this;
     }
-
-    constexpr auto operator=(char const* str) -> naive_string&
+    constexpr auto operator=(naive_string&& other) noexcept -> naive_string&
     {
-        *this = naive_string(str);
+        if (this != &other)
+        {
+            release();
+            take(other);
+        }
         return *this;
     }
+    constexpr auto operator=(char const* str) -> naive_string&
+    {
+        clear();
+        return append(str);
+    }
 
-    constexpr operator std::string_view() const { return std::string_view{&m_data.front(), size()}; }
+    constexpr operator std::string_view() const { return std::string_view{data(), size()}; }
 
-    [[nodiscard]] constexpr auto begin() const noexcept -> const_iterator { return m_data.begin(); }
-    [[nodiscard]] constexpr auto begin() noexcept -> iterator { return m_data.begin(); }
+    [[nodiscard]] constexpr auto begin() const noexcept -> const_iterator { return data(); }
+    [[nodiscard]] constexpr auto begin() noexcept -> iterator { return data(); }
 
-    [[nodiscard]] constexpr auto end() const noexcept -> const_iterator { return m_data.end() - 1; }
-    [[nodiscard]] constexpr auto end() noexcept -> iterator { return m_data.end() - 1; }
+    [[nodiscard]] constexpr auto end() const noexcept -> const_iterator { return data() + size(); }
+    [[nodiscard]] constexpr auto end() noexcept -> iterator { return data() + size(); }
 
     [[nodiscard]] constexpr auto rbegin() const noexcept { return std::make_reverse_iterator(end()); }
     [[nodiscard]] constexpr auto rbegin() noexcept { return std::make_reverse_iterator(end()); }
@@ -81,62 +113,176 @@ class naive_string
     [[nodiscard]] constexpr auto rend() const noexcept { return std::make_reverse_iterator(begin()); }
     [[nodiscard]] constexpr auto rend() noexcept { return std::make_reverse_iterator(begin()); }
 
-    [[nodiscard]] constexpr auto data() const noexcept -> char const* { return m_data.data(); }
-    [[nodiscard]] constexpr auto data() noexcept -> char* { return m_data.data(); }
+    [[nodiscard]] constexpr auto data() const noexcept -> char const* { return m_heap ? m_heap : m_inline; }
+    [[nodiscard]] constexpr auto data() noexcept -> char* { return m_heap ? m_heap : m_inline; }
     [[nodiscard]] constexpr auto c_str() const noexcept -> char const* { return data(); }
 
-    [[nodiscard]] constexpr auto size() const noexcept -> std::size_t { return m_data.size() - 1; }
-    [[nodiscard]] constexpr auto capacity() const noexcept -> std::size_t { return m_data.capacity(); }
+    [[nodiscard]] constexpr auto size() const noexcept -> std::size_t { return m_size; }
+    [[nodiscard]] constexpr auto capacity() const noexcept -> std::size_t { return m_capacity; }
     [[nodiscard]] constexpr auto empty() const noexcept -> bool { return size() == 0; }
+    [[nodiscard]] constexpr static auto max_size() noexcept -> std::size_t
+    {
+        return static_cast<std::size_t>(std::numeric_limits<std::ptrdiff_t>::max()) - 1;
+    }
+
+    constexpr void reserve(std::size_t new_capacity)
+    {
+        if (new_capacity > max_size())
+            throw std::length_error{"naive_string: maximum size exceeded"};
+        if (new_capacity > capacity())
+            reallocate(new_capacity, {});
+    }
+
+    constexpr void clear() noexcept
+    {
+        m_size         = 0;
+        data()[m_size] = '\0';
+    }
 
     constexpr void push_back(char value)
     {
-        m_data.pop_back();
-        m_data.push_back(value);
-        m_data.push_back('\0');
+        if (size() == capacity())
+            reallocate(grown_capacity(grown_size(1)), {});
+        data()[m_size++] = value;
+        data()[m_size]   = '\0';
     }
 
-    constexpr friend auto operator+(naive_string const& lhs, char const* rhs) -> naive_string
+    constexpr auto append(std::string_view sv) -> naive_string&
     {
-        return lhs + naive_string{rhs};
+        auto const new_size = grown_size(sv.size());
+        if (new_size > capacity())
+            reallocate(grown_capacity(new_size), sv);
+        else
+            std::copy_n(sv.data(), sv.size(), data() + size());
+        m_size         = new_size;
+        data()[m_size] = '\0';
+        return *this;
     }
 
+    constexpr friend auto operator+(naive_string const& lhs, char const* rhs) -> naive_string
+    {
+        return concatenate(lhs, std::string_view{rhs});
+    }
     constexpr friend auto operator+(naive_string const& lhs, char rhs) -> naive_string
     {
-        return lhs + naive_string{rhs};
+        return concatenate(lhs, std::string_view{&rhs, 1});
     }
-
     constexpr friend auto operator+(naive_string const& lhs, naive_string const& rhs) -> naive_string
     {
-        auto result = lhs;
-        result += rhs;
-        return result;
+        return concatenate(lhs, rhs);
+    }
+    constexpr friend auto operator+(char const* lhs, naive_string const& rhs) -> naive_string
+    {
+        return concatenate(std::string_view{lhs}, rhs);
     }
 
-    constexpr auto operator+=(naive_string const& rhs) -> naive_string& { return operator+=(std::string_view{rhs}); }
-    constexpr auto operator+=(char const* rhs) -> naive_string& { return operator+=(std::string_view{rhs}); }
-    constexpr auto operator+=(std::string_view rhs) -> naive_string&
+    // Appending to an rvalue reuses its storage, so chains like a + b + c don't copy the intermediate results
+    constexpr friend auto operator+(naive_string&& lhs, char const* rhs) -> naive_string
     {
-        for (auto c : rhs)
-            push_back(c);
+        return std::move(lhs.append(rhs));
+    }
+    constexpr friend auto operator+(naive_string&& lhs, char rhs) -> naive_string
+    {
+        lhs.push_back(rhs);
+        return std::move(lhs);
+    }
+    constexpr friend auto operator+(naive_string&& lhs, naive_string const& rhs) -> naive_string
+    {
+        return std::move(lhs.append(rhs));
+    }
+
+    constexpr auto operator+=(naive_string const& rhs) -> naive_string& { return append(rhs); }
+    constexpr auto operator+=(char const* rhs) -> naive_string& { return append(rhs); }
+    constexpr auto operator+=(std::string_view rhs) -> naive_string& { return append(rhs); }
+    constexpr auto operator+=(char rhs) -> naive_string&
+    {
+        push_back(rhs);
         return *this;
     }
 
-    constexpr auto operator[](std::size_t idx) const noexcept -> const_reference { return m_data[idx]; }
-    constexpr auto operator[](std::size_t idx) noexcept -> reference { return m_data[idx]; }
+    constexpr auto operator[](std::size_t idx) const noexcept -> const_reference { return data()[idx]; }
+    constexpr auto operator[](std::size_t idx) noexcept -> reference { return data()[idx]; }
 
-    constexpr auto operator==(naive_string const&) const noexcept -> bool = default;
-    constexpr auto operator<=>(naive_string const&) const noexcept        = default;
+    constexpr auto operator==(naive_string const& rhs) const noexcept -> bool
+    {
+        return std::string_view{*this} == std::string_view{rhs};
+    }
+    constexpr auto operator<=>(naive_string const& rhs) const noexcept -> std::strong_ordering
+    {
+        return std::string_view{*this} <=> std::string_view{rhs};
+    }
 
   private:
-    bs::vector<char> m_data{'\0'};
+    [[nodiscard]] constexpr static auto concatenate(std::string_view lhs, std::string_view rhs) -> naive_string
+    {
+        naive_string result;
+        result.reserve(lhs.size() + rhs.size());
+        result.append(lhs);
+        result.append(rhs);
+        return result;
+    }
+
+    // Returns the size after adding count characters, throwing if that would exceed max_size()
+    [[nodiscard]] constexpr auto grown_size(std::size_t count) const -> std::size_t
+    {
+        if (count > max_size() - size())
+            throw std::length_error{"naive_string: maximum size exceeded"};
+        return size() + count;
+    }
+
+    // Doubles the capacity, but at least to new_size and at most to max_size()
+    [[nodiscard]] constexpr auto grown_capacity(std::size_t new_size) const noexcept -> std::size_t
+    {
+        return std::max(std::min(2 * capacity(), max_size()), new_size);
+    }
+
+    // Moves the characters to a new heap buffer and appends suffix. suffix may refer to the old buffer.
+    // new_capacity must not exceed max_size(), so the buffer size including the terminating '\0' can't wrap around.
+    constexpr void reallocate(std::size_t new_capacity, std::string_view suffix)
+    {
+        std::allocator<char> allocator;
+        char* const          new_data = allocator.allocate(new_capacity + 1);
+        if (std::is_constant_evaluated())
+            for (std::size_t i = 0; i <= new_capacity; ++i)
+                std::construct_at(new_data + i);
+        std::copy_n(data(), size(), new_data);
+        std::copy_n(suffix.data(), suffix.size(), new_data + size());
+        new_data[size() + suffix.size()] = '\0';
+        release();
+        m_heap     = new_data;
+        m_capacity = new_capacity;
+    }
+
+    constexpr void release() noexcept
+    {
+        if (m_heap)
+            std::allocator<char>{}.deallocate(m_heap, m_capacity + 1);
+    }
+
+    // Takes over the characters of other, which must not own any storage afterwards, and leaves it empty
+    constexpr void take(naive_string& other) noexcept
+    {
+        if (other.m_heap)
+            m_heap = std::exchange(other.m_heap, nullptr);
+        else
+        {
+            m_heap = nullptr;
+            std::copy_n(other.m_inline, other.size() + 1, m_inline);
+        }
+        m_size            = std::exchange(other.m_size, 0);
+        m_capacity        = std::exchange(other.m_capacity, inline_capacity);
+        other.m_inline[0] = '\0';
+    }
+
+    char        m_inline[inline_capacity + 1] = {};
+    char*       m_heap                        = nullptr;
+    std::size_t m_size                        = 0;
+    std::size_t m_capacity                    = inline_capacity;
 };
 
 inline auto operator<<(std::ostream& os, naive_string const& s) -> std::ostream&
 {
-    for (auto c : s)
-        os << c;
-    return os;
+    return os.write(s.data(), static_cast<std::streamsize>(s.size()));
 }
 } // namespace bs
 
@@ -37,7 +37,8 @@
 
 /*
  * Implements a subset of the functionality of std::vector. This is meant as a stopgap solution while many stdlibs don't
- * yet fully support constexpr vector.
+ * yet fully support constexpr vector. Elements are moved, not copied, when the vector grows or elements are inserted
+ * or erased in the middle.
  */
 
 namespace bs
@@ -56,14 +57,7 @@ class naive_vector
     using difference_type = std::ptrdiff_t;
 
     constexpr naive_vector() = default;
-    constexpr ~naive_vector() noexcept
-    {
-        if (capacity() > 0)
-        {
-            std::destroy_n(m_begin, size());
-            m_allocator.deallocate(m_begin, capacity());
-        }
-    }
+    constexpr ~naive_vector() noexcept { release(); }
 
     constexpr naive_vector(std::initializer_list<T> ilist)
         : naive_vector(ilist.begin(), ilist.end())
@@ -73,14 +67,15 @@ class naive_vector
     template<std::forward_iterator Begin, std::sentinel_for<Begin> End>
     constexpr naive_vector(Begin begin, End end)
     {
+        reserve(static_cast<std::size_t>(std::ranges::distance(begin, end)));
         for (std::forward_iterator auto iter = begin; iter != end; ++iter)
             push_back(*iter);
     }
 
     constexpr naive_vector(naive_vector const& other)
-        : m_begin(other.capacity() > 0 ? m_allocator.allocate(other.capacity()) : nullptr)
+        : m_begin(other.empty() ? nullptr : m_allocator.allocate(other.size()))
         , m_size(other.m_size)
-        , m_capacity(other.m_capacity)
+        , m_capacity(other.m_size)
     {
         for (std::size_t i = 0; i < other.size(); ++i)
             std::construct_at(m_begin + i, other[i]);
@@ -97,30 +92,23 @@ class naive_vector
     {
         if (this != &other)
         {
-            if (capacity() > 0)
-            {
-                std::destroy_n(m_begin, size());
-                m_allocator.deallocate(m_begin, capacity());
-            }
-            m_begin    = other.capacity() > 0 ? m_allocator.allocate(other.capacity()) : nullptr;
-            m_size     = other.m_size;
-            m_capacity = other.m_capacity;
-            for (std::size_t i = 0; i < other.size(); ++i)
-                std::construct_at(m_begin + i, other[i]);
+            clear();
+            reserve(other.size());
+            for (; m_size < other.size(); ++m_size)
+                std::construct_at(m_begin + m_size, other[m_size]);
         }
         return *this;
     }
 
     constexpr auto operator=(naive_vector&& other) noexcept -> naive_vector&
     {
-        if (capacity() > 0)
+        if (this != &other)
         {
-            std::destroy_n(m_begin, size());
-            m_allocator.deallocate(m_begin, capacity());
+            release();
+            m_begin    = std::exchange(other.m_begin, nullptr);
+            m_size     = std::exchange(other.m_size, 0);
+            m_capacity = std::exchange(other.m_capacity, 0);
         }
-        m_begin    = std::exchange(other.m_begin, nullptr);
-        m_size     = std::exchange(other.m_size, 0);
-        m_capacity = std::exchange(other.m_capacity, 0);
         return *this;
     }
 
@@ -148,43 +136,66 @@ class naive_vector
     [[nodiscard]] constexpr auto capacity() const noexcept -> std::size_t { return m_capacity; }
     [[nodiscard]] constexpr auto empty() const noexcept -> bool { return size() == 0; }
 
+    constexpr void reserve(std::size_t new_capacity)
+    {
+        if (new_capacity > capacity())
+            reallocate(new_capacity);
+    }
+
+    constexpr void clear() noexcept
+    {
+        std::destroy_n(m_begin, size());
+        m_size = 0;
+    }
+
     constexpr void push_back(T const& value) { emplace_back(value); }
+    constexpr void push_back(T&& value) { emplace_back(std::move(value)); }
 
     template<typename... Ts>
     constexpr auto emplace_back(Ts&&... values) -> reference
     {
         if (m_capacity == m_size)
         {
-            auto const s         = size();
-            auto const c         = capacity();
-            auto const new_c     = c > 0 ? 2 * c : 1;
+            // The new element is constructed first, as the arguments may refer to elements of this vector
+            auto const new_c     = m_capacity > 0 ? 2 * m_capacity : 1;
             T*         new_begin = m_allocator.allocate(new_c);
-            for (std::size_t i = 0; i < s; ++i)
-                std::construct_at(new_begin + i, (*this)[i]);
-            if (c > 0)
-            {
-                std::destroy_n(m_begin, s);
-                m_allocator.deallocate(m_begin, c);
-            }
-            m_begin    = new_begin;
-            m_capacity = new_c;
+            std::construct_at(new_begin + m_size, std::forward<Ts>(values)...);
+            relocate_to(new_begin, new_c);
         }
-        std::construct_at(end(), std::forward<Ts>(values)...);
+        else
+            std::construct_at(end(), std::forward<Ts>(values)...);
         ++m_size;
         return back();
     }
 
-    constexpr auto insert(const_iterator pos, T const& value) -> iterator
+    constexpr auto insert(const_iterator pos, T const& value) -> iterator { return emplace(pos, value); }
+    constexpr auto insert(const_iterator pos, T&& value) -> iterator { return emplace(pos, std::move(value)); }
+
+    template<typename... Ts>
+    constexpr auto emplace(const_iterator pos, Ts&&... values) -> iterator
     {
-        auto const idx = pos ? (pos - m_begin) : 0;
-        push_back(value);
-        if (size() == 1)
-            return begin();
-        auto b = begin() + idx;
-        auto m = end() - 1;
-        auto e = end();
-        std::ranges::rotate(b, m, e);
-        return b;
+        auto const idx = pos ? static_cast<std::size_t>(pos - m_begin) : 0;
+        if (idx == size())
+        {
+            emplace_back(std::forward<Ts>(values)...);
+            return begin() + idx;
+        }
+        T value(std::forward<Ts>(values)...);
+        emplace_back(std::move(back()));
+        std::move_backward(begin() + idx, end() - 2, end() - 1);
+        begin()[idx] = std::move(value);
+        return begin() + idx;
+    }
+
+    constexpr auto erase(const_iterator pos) -> iterator { return erase(pos, pos + 1); }
+    constexpr auto erase(const_iterator first, const_iterator last) -> iterator
+    {
+        auto const idx   = static_cast<std::size_t>(first - m_begin);
+        auto const count = static_cast<std::size_t>(last - first);
+        std::move(begin() + idx + count, end(), begin() + idx);
+        std::destroy_n(end() - count, count);
+        m_size -= count;
+        return begin() + idx;
     }
 
     constexpr void pop_back()
@@ -207,13 +218,35 @@ class naive_vector
     }
 
   private:
+    constexpr void release() noexcept
+    {
+        if (capacity() > 0)
+        {
+            std::destroy_n(m_begin, size());
+            m_allocator.deallocate(m_begin, capacity());
+        }
+    }
+
+    constexpr void reallocate(std::size_t new_capacity)
+    {
+        relocate_to(m_allocator.allocate(new_capacity), new_capacity);
+    }
+
+    // Moves all elements to new_begin, which must hold new_capacity elements, and takes ownership of it
+    constexpr void relocate_to(T* new_begin, std::size_t new_capacity)
+    {
+        for (std::size_t i = 0; i < m_size; ++i)
+            std::construct_at(new_begin + i, std::move(m_begin[i]));
+        release();
+        m_begin    = new_begin;
+        m_capacity = new_capacity;
+    }
+
     std::allocator<T> m_allocator{};
 
     T*          m_begin    = nullptr;
     std::size_t m_size     = 0;
     std::size_t m_capacity = 0;
-
-    friend class naive_string;
 };
 } // namespace bs
 
@@ -25,6 +25,7 @@
 #ifndef BUGSPRAY_MACROS_HPP
 #define BUGSPRAY_MACROS_HPP
 
+#include "macros/macro_attributes.hpp"
 #include "macros/macro_concatenate.hpp"
 #include "macros/macro_get_nth_arg.hpp"
 #include "macros/macro_get_nth_arg_or.hpp"
@@ -0,0 +1,42 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#ifndef BUGSPRAY_MACRO_ATTRIBUTES_HPP
+#define BUGSPRAY_MACRO_ATTRIBUTES_HPP
+
+/*
+ * Provides compiler specific function attributes.
+ *
+ * BUGSPRAY_COLD_PATH marks a function as rarely called and keeps it from being inlined, so that its code is moved
+ * out of the hot path of every caller. It doesn't affect constant evaluation.
+ */
+
+#if defined(__GNUC__) || defined(__clang__)
+#define BUGSPRAY_COLD_PATH [[gnu::cold, gnu::noinline]]
+#elif defined(_MSC_VER)
+#define BUGSPRAY_COLD_PATH __declspec(noinline)
+#else
+#define BUGSPRAY_COLD_PATH
+#endif
+
+#endif // BUGSPRAY_MACRO_ATTRIBUTES_HPP
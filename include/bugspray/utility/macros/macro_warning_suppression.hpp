@@ -46,6 +46,11 @@
 #define BUGSPRAY_DISABLE_WARNING_UNUSED_VALUE BUGSPRAY_DISABLE_WARNING(-Wunused-value)
 #define BUGSPRAY_DISABLE_WARNING_UNUSED_RESULT BUGSPRAY_DISABLE_WARNING(-Wunused-result)
 #define BUGSPRAY_DISABLE_WARNING_MISSING_FIELD_INITIALIZERS BUGSPRAY_DISABLE_WARNING(-Wmissing-field-initializers)
+#if defined(__clang__)
+#define BUGSPRAY_DISABLE_WARNING_NON_TEMPLATE_FRIEND
+#else
+#define BUGSPRAY_DISABLE_WARNING_NON_TEMPLATE_FRIEND BUGSPRAY_DISABLE_WARNING(-Wnon-template-friend)
+#endif
 // clang-format on
 
 #else
@@ -56,6 +61,7 @@
 #define BUGSPRAY_DISABLE_WARNING_UNUSED_VALUE
 #define BUGSPRAY_DISABLE_WARNING_UNUSED_RESULT
 #define BUGSPRAY_DISABLE_WARNING_MISSING_FIELD_INITIALIZERS
+#define BUGSPRAY_DISABLE_WARNING_NON_TEMPLATE_FRIEND
 
 #endif
 
@@ -0,0 +1,83 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef BUGSPRAY_STRUCTURAL_BUFFER_HPP
+#define BUGSPRAY_STRUCTURAL_BUFFER_HPP
+
+#include "bugspray/utility/structural_string.hpp"
+
+#include <algorithm>
+#include <string_view>
+
+#include <cstddef>
+
+/*
+ * structural_buffer is a fixed capacity character buffer that keeps track of its length. Unlike structural_string,
+ * appending to it and querying its size don't scan the whole buffer, so strings can be composed in it piece by piece
+ * at constant cost per character. Appends beyond the capacity are cut off. Like structural_string, it can be used as
+ * NTTP, and to_structural_string() turns it into a structural_string of minimal size once composition is done.
+ */
+
+namespace bs
+{
+template<std::size_t N>
+struct structural_buffer
+{
+    char        value[N] = {};
+    std::size_t length   = 0;
+
+    constexpr auto append(std::string_view sv) noexcept -> structural_buffer&
+    {
+        auto const length_to_copy = std::min(sv.size(), N - length);
+        std::copy_n(sv.data(), length_to_copy, value + length);
+        length += length_to_copy;
+        return *this;
+    }
+    constexpr auto append(char c) noexcept -> structural_buffer&
+    {
+        if (length < N)
+            value[length++] = c;
+        return *this;
+    }
+    constexpr void push_back(char c) noexcept { append(c); }
+
+    [[nodiscard]] constexpr auto size() const noexcept -> std::size_t { return length; }
+    [[nodiscard]] constexpr static auto capacity() noexcept -> std::size_t { return N; }
+
+    constexpr explicit operator std::string_view() const noexcept { return {value, length}; }
+
+    constexpr auto operator==(std::string_view rhs) const noexcept -> bool
+    {
+        return static_cast<std::string_view>(*this) == rhs;
+    }
+};
+
+template<structural_buffer B>
+constexpr auto to_structural_string() noexcept -> structural_string<B.size() + 1>
+{
+    return structural_string<B.size() + 1>{static_cast<std::string_view>(B)};
+}
+} // namespace bs
+
+#endif // BUGSPRAY_STRUCTURAL_BUFFER_HPP
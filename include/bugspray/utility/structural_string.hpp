@@ -90,8 +90,9 @@ template<std::size_t N1, std::size_t N2>
 constexpr auto operator+(structural_string<N1> lhs, structural_string<N2> rhs) -> structural_string<N1 + N2>
 {
     structural_string<N1 + N2> result;
-    std::copy_n(lhs.value, lhs.size(), result.value + 0);
-    std::copy_n(rhs.value, rhs.size(), result.value + lhs.size());
+    auto const                 lhs_size = lhs.size();
+    std::copy_n(lhs.value, lhs_size, result.value + 0);
+    std::copy_n(rhs.value, rhs.size(), result.value + lhs_size);
     return result;
 }
 
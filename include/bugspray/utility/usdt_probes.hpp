@@ -0,0 +1,64 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef BUGSPRAY_USDT_PROBES_HPP
+#define BUGSPRAY_USDT_PROBES_HPP
+
+#include <type_traits>
+
+/*
+ * BUGSPRAY_USDT_PROBE<n>(<name>, <args...>) places a USDT (user-level statically defined tracing) probe with the
+ * provider "bugspray" and n arguments. Tools like bpftrace or perf can attach to these probes in a running test binary.
+ *
+ * Probes are only compiled in if BUGSPRAY_ENABLE_USDT_PROBES is defined and <sys/sdt.h> is available. Otherwise, the
+ * macros expand to nothing. A compiled-in probe that no tool is attached to costs a single nop.
+ *
+ * Inline assembly cannot be constant evaluated, therefore probes are skipped during constant evaluation.
+ */
+
+#if defined(BUGSPRAY_ENABLE_USDT_PROBES) && __has_include(<sys/sdt.h>)
+#include <sys/sdt.h>
+
+#define BUGSPRAY_USDT_PROBE_IMPL(...)                                                                                  \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        if (!std::is_constant_evaluated())                                                                             \
+        {                                                                                                              \
+            __VA_ARGS__;                                                                                               \
+        }                                                                                                              \
+    } while (false)
+
+#define BUGSPRAY_USDT_PROBE1(name, a1) BUGSPRAY_USDT_PROBE_IMPL(STAP_PROBE1(bugspray, name, a1))
+#define BUGSPRAY_USDT_PROBE2(name, a1, a2) BUGSPRAY_USDT_PROBE_IMPL(STAP_PROBE2(bugspray, name, a1, a2))
+#define BUGSPRAY_USDT_PROBE3(name, a1, a2, a3) BUGSPRAY_USDT_PROBE_IMPL(STAP_PROBE3(bugspray, name, a1, a2, a3))
+#define BUGSPRAY_USDT_PROBE4(name, a1, a2, a3, a4)                                                                     \
+    BUGSPRAY_USDT_PROBE_IMPL(STAP_PROBE4(bugspray, name, a1, a2, a3, a4))
+#else
+#define BUGSPRAY_USDT_PROBE1(name, a1)
+#define BUGSPRAY_USDT_PROBE2(name, a1, a2)
+#define BUGSPRAY_USDT_PROBE3(name, a1, a2, a3)
+#define BUGSPRAY_USDT_PROBE4(name, a1, a2, a3, a4)
+#endif
+
+#endif // BUGSPRAY_USDT_PROBES_HPP
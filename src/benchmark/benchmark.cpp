@@ -0,0 +1,50 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "bugspray/benchmark/benchmark.hpp"
+
+namespace bs::detail
+{
+auto clock_resolution() -> double
+{
+    static double const resolution = []
+    {
+        using clock = chronometer::clock;
+
+        constexpr std::size_t ticks = 1000;
+
+        auto last = clock::now();
+        auto sum  = clock::duration{};
+        for (std::size_t i = 0; i < ticks; ++i)
+        {
+            auto now = clock::now();
+            while (now == last)
+                now = clock::now();
+            sum += now - last;
+            last = now;
+        }
+        return std::chrono::duration<double, std::nano>{sum}.count() / static_cast<double>(ticks);
+    }();
+    return resolution;
+}
+} // namespace bs::detail
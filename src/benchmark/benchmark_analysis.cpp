@@ -0,0 +1,328 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "bugspray/benchmark/benchmark_analysis.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numbers>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace bs
+{
+namespace
+{
+auto mean(std::span<double const> values) -> double
+{
+    return std::accumulate(values.begin(), values.end(), 0.) / static_cast<double>(values.size());
+}
+
+auto standard_deviation(std::span<double const> values) -> double
+{
+    auto const m   = mean(values);
+    auto const sum = std::accumulate(values.begin(),
+                                     values.end(),
+                                     0.,
+                                     [m](double acc, double x) { return acc + (x - m) * (x - m); });
+    return std::sqrt(sum / static_cast<double>(values.size()));
+}
+
+// The k-th q-quantile, interpolating between neighbouring values
+auto weighted_average_quantile(std::size_t k, std::size_t q, std::vector<double> values) -> double
+{
+    auto const index = static_cast<double>(values.size() - 1) * static_cast<double>(k) / static_cast<double>(q);
+    auto const j     = static_cast<std::size_t>(index);
+    auto const g     = index - static_cast<double>(j);
+
+    std::ranges::nth_element(values, values.begin() + static_cast<std::ptrdiff_t>(j));
+    auto const xj = values[j];
+    if (g == 0.)
+        return xj;
+    auto const xj1 = *std::min_element(values.begin() + static_cast<std::ptrdiff_t>(j + 1), values.end());
+    return xj + g * (xj1 - xj);
+}
+
+auto normal_cdf(double x) -> double
+{
+    return 0.5 * std::erfc(-x / std::sqrt(2.));
+}
+
+// Acklam's rational approximation, refined by one step of Halley's method
+auto normal_quantile(double p) -> double
+{
+    constexpr std::array a = {-3.969683028665376e+01,
+                              2.209460984245205e+02,
+                              -2.759285104469687e+02,
+                              1.383577518672690e+02,
+                              -3.066479806614716e+01,
+                              2.506628277459239e+00};
+    constexpr std::array b = {-5.447609879822406e+01,
+                              1.615858368580409e+02,
+                              -1.556989798598866e+02,
+                              6.680131188771972e+01,
+                              -1.328068155288572e+01};
+    constexpr std::array c = {-7.784894002430293e-03,
+                              -3.223964580411365e-01,
+                              -2.400758277161838e+00,
+                              -2.549732539343734e+00,
+                              4.374664141464968e+00,
+                              2.938163982698783e+00};
+    constexpr std::array d = {7.784695709041462e-03,
+                              3.224671290700398e-01,
+                              2.445134137142996e+00,
+                              3.754408661907416e+00};
+    constexpr double     p_low = 0.02425;
+
+    double x = 0.;
+    if (p < p_low)
+    {
+        auto const q = std::sqrt(-2. * std::log(p));
+        x = (((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5])
+          / ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1.);
+    }
+    else if (p <= 1. - p_low)
+    {
+        auto const q = p - 0.5;
+        auto const r = q * q;
+        x = (((((a[0] * r + a[1]) * r + a[2]) * r + a[3]) * r + a[4]) * r + a[5]) * q
+          / (((((b[0] * r + b[1]) * r + b[2]) * r + b[3]) * r + b[4]) * r + 1.);
+    }
+    else
+    {
+        auto const q = std::sqrt(-2. * std::log(1. - p));
+        x = -(((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5])
+          / ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1.);
+    }
+
+    auto const e = normal_cdf(x) - p;
+    auto const u = e * std::sqrt(2. * std::numbers::pi) * std::exp(x * x / 2.);
+    return x - u / (1. + x * u / 2.);
+}
+
+template<typename Estimator>
+auto jackknife(Estimator&& estimator, std::span<double const> samples) -> std::vector<double>
+{
+    std::vector<double> result;
+    result.reserve(samples.size());
+
+    std::vector<double> rest(samples.size() - 1);
+    for (std::size_t i = 0; i < samples.size(); ++i)
+    {
+        std::copy(samples.begin(), samples.begin() + static_cast<std::ptrdiff_t>(i), rest.begin());
+        std::copy(samples.begin() + static_cast<std::ptrdiff_t>(i + 1),
+                  samples.end(),
+                  rest.begin() + static_cast<std::ptrdiff_t>(i));
+        result.push_back(estimator(rest));
+    }
+    return result;
+}
+
+// Bias-corrected and accelerated bootstrap interval, given the sorted estimates of all resamples
+template<typename Estimator>
+auto bootstrap(double                  confidence_level,
+               std::span<double const> samples,
+               std::span<double const> sorted_resamples,
+               Estimator&&             estimator) -> benchmark_estimate
+{
+    auto const point = estimator(samples);
+    if (samples.size() == 1 || sorted_resamples.empty())
+        return {point, point, point, confidence_level};
+
+    auto const jack      = jackknife(estimator, samples);
+    auto const jack_mean = mean(jack);
+
+    double sum_squares = 0.;
+    double sum_cubes   = 0.;
+    for (double const x : jack)
+    {
+        auto const difference = jack_mean - x;
+        sum_squares += difference * difference;
+        sum_cubes += difference * difference * difference;
+    }
+    auto const accel = sum_squares > 0. ? sum_cubes / (6. * std::pow(sum_squares, 1.5)) : 0.;
+
+    auto const n      = static_cast<long>(sorted_resamples.size());
+    auto const below  = std::ranges::count_if(sorted_resamples, [point](double x) { return x < point; });
+    auto const prob_n = static_cast<double>(below) / static_cast<double>(n);
+    // Degenerate case of uniform samples
+    if (prob_n == 0.)
+        return {point, point, point, confidence_level};
+
+    auto const bias = normal_quantile(prob_n);
+    auto const z1   = normal_quantile((1. - confidence_level) / 2.);
+
+    auto const cumn = [n](double x) { return std::lround(normal_cdf(x) * static_cast<double>(n)); };
+    auto const a    = [bias, accel](double b) { return bias + b / (1. - accel * b); };
+
+    auto const lo = static_cast<std::size_t>(std::max(cumn(a(bias + z1)), 0L));
+    auto const hi = static_cast<std::size_t>(std::min(cumn(a(bias - z1)), n - 1));
+    return {point, sorted_resamples[lo], sorted_resamples[hi], confidence_level};
+}
+
+// How much of the variance can be explained by outliers; from criterion
+auto outlier_variance(benchmark_estimate const& mean_estimate,
+                      benchmark_estimate const& stddev_estimate,
+                      std::size_t               count) -> double
+{
+    auto const n  = static_cast<double>(count);
+    auto const sb = stddev_estimate.point;
+    if (sb <= 0.)
+        return 0.;
+
+    auto const mn     = mean_estimate.point / n;
+    auto const mg_min = mn / 2.;
+    auto const sg     = std::min(mg_min / 4., sb / std::sqrt(n));
+    auto const sg2    = sg * sg;
+    auto const sb2    = sb * sb;
+
+    auto const c_max = [n, mn, sb2, sg2](double x) -> double
+    {
+        auto const k   = mn - x;
+        auto const d   = k * k;
+        auto const nd  = n * d;
+        auto const k0  = -n * nd;
+        auto const k1  = sb2 - n * sg2 + nd;
+        auto const det = k1 * k1 - 4. * sg2 * k0;
+        return std::trunc(-2. * k0 / (k1 + std::sqrt(det)));
+    };
+    auto const var_out = [n, sb2, sg2](double c)
+    {
+        auto const nc = n - c;
+        return (nc / n) * (sb2 - nc * sg2);
+    };
+
+    return std::min(var_out(1.), var_out(std::min(c_max(0.), c_max(mg_min)))) / sb2;
+}
+} // namespace
+
+auto classify_outliers(std::span<double const> samples) -> outlier_classification
+{
+    std::vector<double> const copy(samples.begin(), samples.end());
+
+    auto const q1  = weighted_average_quantile(1, 4, copy);
+    auto const q3  = weighted_average_quantile(3, 4, copy);
+    auto const iqr = q3 - q1;
+    auto const los = q1 - (iqr * 3.);
+    auto const lom = q1 - (iqr * 1.5);
+    auto const him = q3 + (iqr * 1.5);
+    auto const his = q3 + (iqr * 3.);
+
+    outlier_classification o;
+    for (double const t : samples)
+    {
+        if (t < los)
+            ++o.low_severe;
+        else if (t < lom)
+            ++o.low_mild;
+        else if (t > his)
+            ++o.high_severe;
+        else if (t > him)
+            ++o.high_mild;
+        ++o.samples_seen;
+    }
+    return o;
+}
+
+auto analyse_samples(std::span<double const> samples,
+                     std::size_t             resamples,
+                     double                  confidence_interval,
+                     std::uint64_t           seed) -> sample_analysis
+{
+    std::mt19937_64                            rng{seed};
+    std::uniform_int_distribution<std::size_t> dist{0, samples.size() - 1};
+
+    std::vector<double> resampled_means;
+    std::vector<double> resampled_stddevs;
+    resampled_means.reserve(resamples);
+    resampled_stddevs.reserve(resamples);
+
+    std::vector<double> resample(samples.size());
+    for (std::size_t i = 0; i < resamples; ++i)
+    {
+        std::ranges::generate(resample, [&] { return samples[dist(rng)]; });
+        resampled_means.push_back(mean(resample));
+        resampled_stddevs.push_back(standard_deviation(resample));
+    }
+    std::ranges::sort(resampled_means);
+    std::ranges::sort(resampled_stddevs);
+
+    sample_analysis result;
+    result.mean               = bootstrap(confidence_interval, samples, resampled_means, mean);
+    result.standard_deviation = bootstrap(confidence_interval, samples, resampled_stddevs, standard_deviation);
+    result.outliers           = classify_outliers(samples);
+    result.outlier_variance   = outlier_variance(result.mean, result.standard_deviation, samples.size());
+    return result;
+}
+
+auto mann_whitney_u(std::span<double const> baseline, std::span<double const> samples) -> rank_test_result
+{
+    if (baseline.empty() || samples.empty())
+        return {};
+
+    struct ranked
+    {
+        double value;
+        bool   from_samples;
+    };
+    std::vector<ranked> all;
+    all.reserve(baseline.size() + samples.size());
+    for (double const x : baseline)
+        all.push_back({x, false});
+    for (double const x : samples)
+        all.push_back({x, true});
+    std::ranges::sort(all, {}, &ranked::value);
+
+    // Tied values share the average of their ranks; ties reduce the variance of U
+    double rank_sum   = 0.;
+    double tie_amount = 0.;
+    for (std::size_t i = 0; i < all.size();)
+    {
+        auto j = i;
+        while (j < all.size() && all[j].value == all[i].value)
+            ++j;
+        auto const ties = static_cast<double>(j - i);
+        auto const rank = static_cast<double>(i + j + 1) / 2.;
+        for (auto k = i; k < j; ++k)
+            if (all[k].from_samples)
+                rank_sum += rank;
+        tie_amount += ties * ties * ties - ties;
+        i = j;
+    }
+
+    auto const n1 = static_cast<double>(baseline.size());
+    auto const n2 = static_cast<double>(samples.size());
+    auto const n  = n1 + n2;
+    auto const u  = rank_sum - n2 * (n2 + 1.) / 2.;
+
+    auto const variance = n1 * n2 / 12. * ((n + 1.) - tie_amount / (n * (n - 1.)));
+    if (variance <= 0.)
+        return {u, 1.};
+
+    // Normal approximation with continuity correction
+    auto const z = (u - n1 * n2 / 2. - 0.5) / std::sqrt(variance);
+    return {u, normal_cdf(-z)};
+}
+} // namespace bs
@@ -0,0 +1,336 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "bugspray/benchmark/benchmark_baseline.hpp"
+
+#include "bugspray/benchmark/benchmark_analysis.hpp"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+#include <system_error>
+
+namespace bs
+{
+namespace
+{
+void write_json_string(std::ostream& stream, std::string_view str)
+{
+    stream << '"';
+    for (char const c : str)
+    {
+        if (c == '"' || c == '\\')
+            stream << '\\' << c;
+        else if (static_cast<unsigned char>(c) < 0x20)
+            stream << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec
+                   << std::setfill(' ');
+        else
+            stream << c;
+    }
+    stream << '"';
+}
+
+void write_json_number(std::ostream& stream, double value)
+{
+    std::array<char, 32> buffer{};
+    auto const [end, ec] = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+    stream.write(buffer.data(), end - buffer.data());
+}
+
+auto unescape(char c) -> char
+{
+    constexpr std::string_view escaped   = "bfnrt";
+    constexpr std::string_view unescaped = "\b\f\n\r\t";
+
+    auto const i = escaped.find(c);
+    return i != std::string_view::npos ? unescaped[i] : c; // '"', '\\' and '/' stand for themselves
+}
+
+// Reads just enough JSON for baseline files. Unknown members are skipped, so files may carry additional data.
+struct json_reader
+{
+    std::string_view text;
+    std::size_t      pos = 0;
+
+    void skip_whitespace()
+    {
+        while (pos < text.size() && (text[pos] == ' ' || text[pos] == '\t' || text[pos] == '\n' || text[pos] == '\r'))
+            ++pos;
+    }
+
+    auto peek() -> char
+    {
+        skip_whitespace();
+        return pos < text.size() ? text[pos] : '\0';
+    }
+
+    auto consume(char c) -> bool
+    {
+        if (peek() != c)
+            return false;
+        ++pos;
+        return true;
+    }
+
+    auto consume_literal(std::string_view literal) -> bool
+    {
+        skip_whitespace();
+        if (!text.substr(pos).starts_with(literal))
+            return false;
+        pos += literal.size();
+        return true;
+    }
+
+    auto string(std::string& out) -> bool
+    {
+        if (!consume('"'))
+            return false;
+        out.clear();
+        while (pos < text.size() && text[pos] != '"')
+        {
+            char c = text[pos++];
+            if (c == '\\')
+            {
+                if (pos >= text.size())
+                    return false;
+                c = text[pos++];
+                if (c == 'u')
+                {
+                    unsigned code = 0;
+                    if (pos + 4 > text.size())
+                        return false;
+                    auto const [ptr, ec] = std::from_chars(text.data() + pos, text.data() + pos + 4, code, 16);
+                    if (ec != std::errc{} || ptr != text.data() + pos + 4 || code > 0x7f)
+                        return false; // Only ASCII escapes are written
+                    c = static_cast<char>(code);
+                    pos += 4;
+                }
+                else
+                    c = unescape(c);
+            }
+            out.push_back(c);
+        }
+        return consume('"');
+    }
+
+    auto number(double& out) -> bool
+    {
+        skip_whitespace();
+        auto const [ptr, ec] = std::from_chars(text.data() + pos, text.data() + text.size(), out);
+        if (ec != std::errc{})
+            return false;
+        pos = static_cast<std::size_t>(ptr - text.data());
+        return true;
+    }
+
+    template<typename Fun>
+    auto array(Fun&& element) -> bool
+    {
+        if (!consume('['))
+            return false;
+        if (consume(']'))
+            return true;
+        do
+        {
+            if (!element())
+                return false;
+        } while (consume(','));
+        return consume(']');
+    }
+
+    template<typename Fun>
+    auto object(Fun&& member) -> bool
+    {
+        if (!consume('{'))
+            return false;
+        if (consume('}'))
+            return true;
+        std::string key;
+        do
+        {
+            if (!string(key) || !consume(':') || !member(key))
+                return false;
+        } while (consume(','));
+        return consume('}');
+    }
+
+    auto skip_value() -> bool
+    {
+        std::string str;
+        double      num = 0.;
+        switch (peek())
+        {
+        case '{':
+            return object([this](std::string const&) { return skip_value(); });
+        case '[':
+            return array([this] { return skip_value(); });
+        case '"':
+            return string(str);
+        case 't':
+            return consume_literal("true");
+        case 'f':
+            return consume_literal("false");
+        case 'n':
+            return consume_literal("null");
+        default:
+            return number(num);
+        }
+    }
+};
+
+auto read_entry(json_reader& reader, benchmark_baseline_entry& entry) -> bool
+{
+    return reader.object(
+        [&](std::string const& key)
+        {
+            if (key == "test_case")
+                return reader.string(entry.test_case);
+            if (key == "sections")
+                return reader.array([&] { return reader.string(entry.sections.emplace_back()); });
+            if (key == "name")
+                return reader.string(entry.name);
+            if (key == "mean")
+                return reader.number(entry.mean);
+            if (key == "standard_deviation")
+                return reader.number(entry.standard_deviation);
+            if (key == "samples")
+                return reader.array([&] { return reader.number(entry.samples.emplace_back()); });
+            return reader.skip_value();
+        });
+}
+} // namespace
+
+auto benchmark_baseline::read(std::istream& stream) -> std::optional<benchmark_baseline>
+{
+    std::string const text{std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}};
+    json_reader       reader{text};
+
+    benchmark_baseline baseline;
+    bool const         ok = reader.object(
+        [&](std::string const& key)
+        {
+            if (key != "benchmarks")
+                return reader.skip_value();
+            return reader.array(
+                [&]
+                {
+                    benchmark_baseline_entry entry;
+                    if (!read_entry(reader, entry))
+                        return false;
+                    baseline.record(std::move(entry));
+                    return true;
+                });
+        });
+    if (!ok || reader.peek() != '\0')
+        return std::nullopt;
+    return baseline;
+}
+
+void benchmark_baseline::write(std::ostream& stream) const
+{
+    stream << "{\n  \"benchmarks\": [";
+    for (std::size_t i = 0; i < m_entries.size(); ++i)
+    {
+        auto const& e = m_entries[i];
+        stream << (i == 0 ? "\n" : ",\n") << "    {\"test_case\": ";
+        write_json_string(stream, e.test_case);
+        stream << ", \"sections\": [";
+        for (std::size_t j = 0; j < e.sections.size(); ++j)
+        {
+            if (j != 0)
+                stream << ", ";
+            write_json_string(stream, e.sections[j]);
+        }
+        stream << "], \"name\": ";
+        write_json_string(stream, e.name);
+        stream << ", \"mean\": ";
+        write_json_number(stream, e.mean);
+        stream << ", \"standard_deviation\": ";
+        write_json_number(stream, e.standard_deviation);
+        stream << ", \"samples\": [";
+        for (std::size_t j = 0; j < e.samples.size(); ++j)
+        {
+            if (j != 0)
+                stream << ", ";
+            write_json_number(stream, e.samples[j]);
+        }
+        stream << "]}";
+    }
+    stream << "\n  ]\n}\n";
+}
+
+auto benchmark_baseline::find(std::string_view              test_case,
+                              std::span<std::string const> sections,
+                              std::string_view              name) const -> benchmark_baseline_entry const*
+{
+    auto const it = std::ranges::find_if(m_entries,
+                                         [&](benchmark_baseline_entry const& e)
+                                         {
+                                             return e.test_case == test_case && e.name == name &&
+                                                    std::ranges::equal(e.sections, sections);
+                                         });
+    return it != m_entries.end() ? &*it : nullptr;
+}
+
+void benchmark_baseline::record(benchmark_baseline_entry entry)
+{
+    auto const it = std::ranges::find_if(m_entries,
+                                         [&](benchmark_baseline_entry const& e)
+                                         {
+                                             return e.test_case == entry.test_case && e.name == entry.name &&
+                                                    e.sections == entry.sections;
+                                         });
+    if (it != m_entries.end())
+        *it = std::move(entry);
+    else
+        m_entries.push_back(std::move(entry));
+}
+
+auto compare_to_baseline(benchmark_baseline_entry const& baseline,
+                         std::span<double const>         samples,
+                         double                          mean,
+                         double                          threshold,
+                         double                          significance) -> benchmark_comparison
+{
+    benchmark_comparison result;
+    result.baseline_mean = baseline.mean;
+    result.change        = baseline.mean > 0. ? mean / baseline.mean - 1. : 0.;
+    result.p_value       = mann_whitney_u(baseline.samples, samples).p_value;
+    result.threshold     = threshold;
+    result.regression    = result.change > threshold && result.p_value < significance;
+    return result;
+}
+
+auto describe(benchmark_comparison const& comparison) -> std::string
+{
+    std::ostringstream ss;
+    ss << std::showpos << std::fixed << std::setprecision(1) << 100. * comparison.change << std::noshowpos
+       << "% relative to baseline (p = " << std::defaultfloat << std::setprecision(3) << comparison.p_value
+       << ", threshold " << 100. * comparison.threshold << "%)";
+    return ss.str();
+}
+} // namespace bs
@@ -21,17 +21,26 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 //
+#include "bugspray/benchmark/benchmark_baseline.hpp"
+#include "bugspray/benchmark/benchmark_config.hpp"
 #include "bugspray/cli/main_test_runner_argparser.hpp"
 #include "bugspray/reporter/formatted_ostream_reporter.hpp"
+#include "bugspray/reporter/multi_reporter.hpp"
+#include "bugspray/reporter/overhead_reporter.hpp"
+#include "bugspray/reporter/sampling_profiler.hpp"
+#include "bugspray/reporter/section_waste_reporter.hpp"
+#include "bugspray/reporter/trace_event_reporter.hpp"
 #include "bugspray/reporter/xml_reporter.hpp"
 #include "bugspray/test_evaluation/evaluate_test_case.hpp"
 #include "bugspray/test_registration/test_case_registry.hpp"
+#include "bugspray/to_string/stringify_limits.hpp"
 #include "bugspray/version.hpp"
 
 #include <algorithm>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <optional>
 #include <random>
 
 auto main(int argc, char const** argv) -> int
@@ -75,6 +84,34 @@ auto main(int argc, char const** argv) -> int
     else if (c.order == config::order_enum::random)
         std::ranges::shuffle(g_test_case_registry, rand_engine);
 
+    g_benchmark_config.samples     = c.benchmark_samples;
+    g_benchmark_config.resamples   = c.benchmark_resamples;
+    g_benchmark_config.warmup_time = std::chrono::milliseconds{c.benchmark_warmup_time};
+    g_benchmark_config.seed        = c.seed;
+    g_benchmark_config.skip        = c.skip_benchmarks;
+
+    g_benchmark_config.regression_threshold = static_cast<double>(c.benchmark_threshold) / 100.;
+    std::optional<benchmark_baseline> baseline;
+    if (!c.benchmark_baseline.empty())
+    {
+        std::ifstream baseline_filestream{std::filesystem::path{c.benchmark_baseline}};
+        if (baseline_filestream)
+            baseline = benchmark_baseline::read(baseline_filestream);
+        if (!baseline)
+        {
+            std::cerr << "Failed to read benchmark baseline from " << c.benchmark_baseline << '\n';
+            return EXIT_FAILURE;
+        }
+        g_benchmark_config.baseline = &*baseline;
+    }
+    benchmark_baseline recording;
+    if (!c.benchmark_save.empty())
+        g_benchmark_config.recording = &recording;
+
+    g_stringify_limits.max_expansion_length   = c.max_expansion_length;
+    g_stringify_limits.max_container_elements = c.max_container_elements;
+    g_stringify_limits.max_string_length      = c.max_string_length;
+
     bool success = true;
 
     auto reporter = [&]() -> std::unique_ptr<struct reporter>
@@ -86,15 +123,72 @@ auto main(int argc, char const** argv) -> int
             return std::make_unique<formatted_ostream_reporter>(os);
         case xml:
             return std::make_unique<xml_reporter>(os, argv[0], c.seed, c.report_durations);
+        case trace:
+            return std::make_unique<trace_event_reporter>(os);
         }
         return nullptr;
     }
     ();
 
+    multi_reporter reporters;
+    reporters.add(*reporter);
+
+    std::unique_ptr<std::ofstream>     profile_filestream;
+    std::unique_ptr<sampling_profiler> profiler;
+    if (!c.profile_output.empty())
+    {
+        if (sampling_profiler::is_supported())
+        {
+            profile_filestream = std::make_unique<std::ofstream>(std::filesystem::path{c.profile_output});
+            if (!*profile_filestream)
+            {
+                std::cerr << "Failed to open " << c.profile_output << " for writing the profile\n";
+                return EXIT_FAILURE;
+            }
+            profiler = std::make_unique<sampling_profiler>(*profile_filestream);
+            reporters.add(*profiler);
+        }
+        else
+            std::cerr << "Profiling is not supported on this platform, ignoring --profile\n";
+    }
+
+    std::unique_ptr<section_waste_reporter> section_waste;
+    if (c.section_waste)
+    {
+        section_waste = std::make_unique<section_waste_reporter>(std::cerr);
+        reporters.add(*section_waste);
+    }
+
+    std::unique_ptr<overhead_reporter> overhead;
+    if (c.measure_overhead)
+        overhead = std::make_unique<overhead_reporter>(reporters, std::cerr);
+    bs::reporter& active_reporter = overhead ? static_cast<bs::reporter&>(*overhead) : reporters;
+
     for (auto&& tc : g_test_case_registry)
-        success &= evaluate_test_case(tc, *reporter, c.test_spec);
-    reporter->finalize();
+        success &= evaluate_test_case(tc, active_reporter, c.test_spec);
+    active_reporter.finalize();
     os << std::endl;
 
+    if (profile_filestream)
+    {
+        profile_filestream->flush();
+        if (!*profile_filestream)
+        {
+            std::cerr << "Failed to write the profile to " << c.profile_output << '\n';
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (!c.benchmark_save.empty())
+    {
+        std::ofstream save_filestream{std::filesystem::path{c.benchmark_save}};
+        recording.write(save_filestream);
+        if (!save_filestream)
+        {
+            std::cerr << "Failed to write benchmark results to " << c.benchmark_save << '\n';
+            return EXIT_FAILURE;
+        }
+    }
+
     return success ? EXIT_SUCCESS : EXIT_FAILURE;
 }
\ No newline at end of file
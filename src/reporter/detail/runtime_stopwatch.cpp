@@ -38,10 +38,10 @@ void runtime_stopwatch::start_test_case_timer()
     m_test_case_start_time = std::chrono::steady_clock::now();
 }
 
-auto runtime_stopwatch::stop_test_case_timer() -> std::chrono::milliseconds
+auto runtime_stopwatch::stop_test_case_timer() -> std::chrono::steady_clock::duration
 {
     auto const now = std::chrono::steady_clock::now();
-    return std::chrono::duration_cast<std::chrono::milliseconds>(now - m_test_case_start_time);
+    return now - m_test_case_start_time;
 }
 
 void runtime_stopwatch::start_section_timer()
@@ -50,7 +50,7 @@ void runtime_stopwatch::start_section_timer()
     m_section_start_time.push_back(now);
 }
 
-auto runtime_stopwatch::stop_section_timer() -> std::chrono::milliseconds
+auto runtime_stopwatch::stop_section_timer() -> std::chrono::steady_clock::duration
 {
     auto const now = std::chrono::steady_clock::now();
 
@@ -58,6 +58,6 @@ auto runtime_stopwatch::stop_section_timer() -> std::chrono::milliseconds
     auto const start = m_section_start_time.back();
     m_section_start_time.pop_back();
 
-    return std::chrono::duration_cast<std::chrono::milliseconds>(now - start);
+    return now - start;
 }
 } // namespace bs::detail
\ No newline at end of file
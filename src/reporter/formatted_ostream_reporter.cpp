@@ -24,10 +24,39 @@
 
 #include "bugspray/reporter/formatted_ostream_reporter.hpp"
 
+#include "bugspray/benchmark/benchmark_baseline.hpp"
+
+#include <array>
+#include <cmath>
+#include <iomanip>
 #include <ranges>
+#include <sstream>
+#include <utility>
 
 namespace bs
 {
+namespace
+{
+constexpr int benchmark_name_width   = 37;
+constexpr int benchmark_column_width = 14;
+
+auto format_duration(double nanoseconds) -> std::string
+{
+    constexpr std::array<std::string_view, 4> units = {"ns", "us", "ms", "s"};
+
+    std::size_t unit = 0;
+    while (std::abs(nanoseconds) >= 1000. && unit + 1 < units.size())
+    {
+        nanoseconds /= 1000.;
+        ++unit;
+    }
+
+    std::ostringstream ss;
+    ss << std::setprecision(6) << nanoseconds << ' ' << units[unit];
+    return ss.str();
+}
+} // namespace
+
 formatted_ostream_reporter::formatted_ostream_reporter(std::ostream& stream)
     : m_stream(stream)
 {
@@ -43,6 +72,8 @@ void formatted_ostream_reporter::enter_test_case(std::string_view
         .sloc = sloc,
     };
     m_failed_assertion_in_this_test_case = false;
+    m_reported_test_case_head            = false;
+    m_reported_benchmark_head            = false;
     ++m_stats.m_num_test_cases;
 }
 
@@ -64,6 +95,43 @@ void formatted_ostream_reporter::log_target(section_path const& target) noexcept
     m_cur_target = target;
 }
 
+void formatted_ostream_reporter::log_benchmark(benchmark_result const& result) noexcept
+{
+    report_test_case_head(m_cur_test_case);
+    report_benchmark_head();
+
+    auto const row = [this](std::string_view first, auto const& a, auto const& b, auto const& c)
+    {
+        m_stream << std::left << std::setw(benchmark_name_width) << first.substr(0, benchmark_name_width - 1)
+                 << std::right << std::setw(benchmark_column_width) << a << std::setw(benchmark_column_width) << b
+                 << std::setw(benchmark_column_width) << c << std::left << '\n';
+    };
+
+    row(result.name, result.samples, result.iterations, format_duration(result.estimated_duration));
+    row("",
+        format_duration(result.mean.point),
+        format_duration(result.mean.lower_bound),
+        format_duration(result.mean.upper_bound));
+    row("",
+        format_duration(result.standard_deviation.point),
+        format_duration(result.standard_deviation.lower_bound),
+        format_duration(result.standard_deviation.upper_bound));
+
+    if (auto const outliers = result.outliers.total(); outliers > 0)
+        m_stream << "found " << outliers << " outliers among " << result.outliers.samples_seen << " samples ("
+                 << 100. * static_cast<double>(outliers) / static_cast<double>(result.outliers.samples_seen) << "%)\n";
+    if (result.comparison)
+        m_stream << "baseline mean " << format_duration(result.comparison->baseline_mean) << ", "
+                 << describe(*result.comparison) << (result.comparison->regression ? ": REGRESSION\n" : "\n");
+    m_stream << '\n';
+}
+
+void formatted_ostream_reporter::log_metric(std::string_view name, double value, std::string_view unit) noexcept
+{
+    report_test_case_head(m_cur_test_case);
+    m_stream << "metric " << name << ": " << value << ' ' << unit << '\n';
+}
+
 void formatted_ostream_reporter::enter_section(std::string_view name, source_location sloc) noexcept
 {
     m_cur_section.push_back({name, sloc});
@@ -125,6 +193,16 @@ void formatted_ostream_reporter::log_assertion(std::string_view            asser
     m_stream << '\n';
 }
 
+auto formatted_ostream_reporter::needs_passed_assertions() const noexcept -> bool
+{
+    return false;
+}
+
+void formatted_ostream_reporter::log_passed_assertions(std::size_t count) noexcept
+{
+    m_stats.m_num_assertions += count;
+}
+
 void formatted_ostream_reporter::finalize() noexcept
 {
     auto const total_test_cases  = m_stats.m_num_test_cases;
@@ -142,6 +220,9 @@ void formatted_ostream_reporter::finalize() noexcept
 
 void formatted_ostream_reporter::report_test_case_head(test_case_data const& data)
 {
+    if (std::exchange(m_reported_test_case_head, true))
+        return;
+
     m_stream << "-------------------------------------------------------------------------------\n";
     m_stream << data.name << '\n';
     m_stream << "-------------------------------------------------------------------------------\n";
@@ -150,4 +231,19 @@ void formatted_ostream_reporter::report_test_case_head(test_case_data const& dat
     m_stream << '\n';
 }
 
-} // namespace bs
\ No newline at end of file
+void formatted_ostream_reporter::report_benchmark_head()
+{
+    if (std::exchange(m_reported_benchmark_head, true))
+        return;
+
+    auto const row = [this](std::string_view a, std::string_view b, std::string_view c, std::string_view d)
+    {
+        m_stream << std::left << std::setw(benchmark_name_width) << a << std::setw(benchmark_column_width) << b
+                 << std::setw(benchmark_column_width) << c << d << '\n';
+    };
+    row("benchmark name", "samples", "iterations", "estimated");
+    row("", "mean", "low mean", "high mean");
+    row("", "std dev", "low std dev", "high std dev");
+    m_stream << "-------------------------------------------------------------------------------\n";
+}
+} // namespace bs
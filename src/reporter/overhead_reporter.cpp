@@ -0,0 +1,192 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "bugspray/reporter/overhead_reporter.hpp"
+
+#include <algorithm>
+#include <array>
+#include <iomanip>
+#include <numeric>
+#include <utility>
+
+namespace bs
+{
+namespace
+{
+constexpr std::array<std::string_view, overhead_category_count> category_names = {
+    "test code",
+    "evaluation",
+    "sections",
+    "assertions",
+    "captures",
+    "reporter",
+};
+
+constexpr std::size_t max_name_width = 40;
+} // namespace
+
+overhead_reporter::overhead_reporter(reporter& inner, std::ostream& stream)
+    : m_inner(inner)
+    , m_stream(stream)
+    , m_previous_accountant(std::exchange(g_overhead_accountant, &m_accountant))
+{
+}
+
+overhead_reporter::~overhead_reporter()
+{
+    g_overhead_accountant = m_previous_accountant;
+}
+
+void overhead_reporter::enter_test_case(std::string_view                  name,
+                                        std::span<std::string_view const> tags,
+                                        source_location                   sloc) noexcept
+{
+    m_accountant.reset();
+    m_current_test_case = name;
+
+    overhead_scope const scope{overhead_category::reporter};
+    m_inner.enter_test_case(name, tags, sloc);
+}
+
+void overhead_reporter::leave_test_case() noexcept
+{
+    {
+        overhead_scope const scope{overhead_category::reporter};
+        m_inner.leave_test_case();
+    }
+    m_test_cases.push_back({std::string{m_current_test_case}, m_accountant.totals()});
+}
+
+void overhead_reporter::start_run() noexcept
+{
+    overhead_scope const scope{overhead_category::reporter};
+    m_inner.start_run();
+}
+
+void overhead_reporter::stop_run() noexcept
+{
+    overhead_scope const scope{overhead_category::reporter};
+    m_inner.stop_run();
+}
+
+void overhead_reporter::log_target(section_path const& target) noexcept
+{
+    overhead_scope const scope{overhead_category::reporter};
+    m_inner.log_target(target);
+}
+
+void overhead_reporter::log_benchmark(benchmark_result const& result) noexcept
+{
+    overhead_scope const scope{overhead_category::reporter};
+    m_inner.log_benchmark(result);
+}
+
+void overhead_reporter::log_metric(std::string_view name, double value, std::string_view unit) noexcept
+{
+    overhead_scope const scope{overhead_category::reporter};
+    m_inner.log_metric(name, value, unit);
+}
+
+void overhead_reporter::enter_section(std::string_view name, source_location sloc) noexcept
+{
+    overhead_scope const scope{overhead_category::reporter};
+    m_inner.enter_section(name, sloc);
+}
+
+void overhead_reporter::leave_section() noexcept
+{
+    overhead_scope const scope{overhead_category::reporter};
+    m_inner.leave_section();
+}
+
+void overhead_reporter::log_assertion(std::string_view            assertion,
+                                      source_location             sloc,
+                                      std::string_view            expansion,
+                                      std::span<bs::string const> messages,
+                                      bool                        result) noexcept
+{
+    overhead_scope const scope{overhead_category::reporter};
+    m_inner.log_assertion(assertion, sloc, expansion, messages, result);
+}
+
+auto overhead_reporter::needs_passed_assertions() const noexcept -> bool
+{
+    return m_inner.needs_passed_assertions();
+}
+
+void overhead_reporter::log_passed_assertions(std::size_t count) noexcept
+{
+    overhead_scope const scope{overhead_category::reporter};
+    m_inner.log_passed_assertions(count);
+}
+
+void overhead_reporter::finalize() noexcept
+{
+    m_inner.finalize();
+    write_table();
+}
+
+void overhead_reporter::write_table()
+{
+    using milliseconds = std::chrono::duration<double, std::milli>;
+
+    std::size_t name_width = std::string_view{"test case"}.size();
+    for (auto&& tc : m_test_cases)
+        name_width = std::clamp(tc.name.size(), name_width, max_name_width);
+
+    auto const write_row = [&](std::string_view name, overhead_accountant::durations const& durations)
+    {
+        auto const total =
+            std::accumulate(durations.begin(), durations.end(), overhead_accountant::clock::duration{});
+        auto const framework = total - durations[static_cast<std::size_t>(overhead_category::test_code)];
+
+        m_stream << std::left << std::setw(static_cast<int>(name_width)) << name.substr(0, name_width) << std::right;
+        for (std::size_t i = 0; i < overhead_category_count; ++i)
+            m_stream << "  " << std::setw(static_cast<int>(category_names[i].size()))
+                     << milliseconds{durations[i]}.count();
+        auto const share = total.count() > 0 ? 100. * framework.count() / total.count() : 0.;
+        m_stream << "  " << std::setw(8) << share << "%\n";
+    };
+
+    m_stream << "\nFramework overhead per test case [ms]:\n";
+    m_stream << std::left << std::setw(static_cast<int>(name_width)) << "test case" << std::right;
+    for (auto&& category : category_names)
+        m_stream << "  " << category;
+    m_stream << "  framework\n";
+
+    auto const flags = m_stream.flags();
+    m_stream << std::fixed << std::setprecision(3);
+
+    overhead_accountant::durations sum{};
+    for (auto&& tc : m_test_cases)
+    {
+        write_row(tc.name, tc.durations);
+        for (std::size_t i = 0; i < overhead_category_count; ++i)
+            sum[i] += tc.durations[i];
+    }
+    write_row("total", sum);
+
+    m_stream.flags(flags);
+    m_stream.flush();
+}
+} // namespace bs
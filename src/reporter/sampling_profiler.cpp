@@ -0,0 +1,330 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "bugspray/reporter/sampling_profiler.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <map>
+#include <span>
+#include <utility>
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+
+#if __has_include(<execinfo.h>) && __has_include(<sys/time.h>) && __has_include(<cxxabi.h>)
+    #define BUGSPRAY_HAS_SAMPLING_PROFILER 1
+    #include <cxxabi.h>
+    #include <execinfo.h>
+    #include <sys/time.h>
+
+    #include <csignal>
+#else
+    #define BUGSPRAY_HAS_SAMPLING_PROFILER 0
+#endif
+
+namespace bs
+{
+namespace
+{
+constexpr std::size_t max_frames  = 48;
+constexpr std::size_t max_samples = std::size_t{1} << 14;
+
+// The frames belonging to the signal handler and the signal trampoline
+constexpr std::size_t skipped_frames = 2;
+
+constexpr std::string_view outside_test_cases = "(outside test cases)";
+
+auto sanitize_frame(std::string str) -> std::string
+{
+    // ';' separates frames in the folded format
+    std::ranges::replace(str, ';', ':');
+    return str;
+}
+} // namespace
+
+namespace
+{
+struct sample_storage
+{
+    struct sample
+    {
+        std::uint32_t                  context;
+        std::uint32_t                  depth;
+        std::array<void*, max_frames> frames;
+    };
+
+    std::unique_ptr<sample[]> samples = std::make_unique<sample[]>(max_samples);
+
+    std::atomic<std::size_t>   next_sample{0};
+    std::atomic<std::size_t>   dropped_samples{0};
+    std::atomic<std::uint32_t> context{0};
+};
+
+std::atomic<sample_storage*> g_active_buffer{nullptr};
+
+#if BUGSPRAY_HAS_SAMPLING_PROFILER
+// Must be async-signal-safe: only atomics and backtrace(), which has been primed in the constructor so it does not
+// need to load libgcc from within the handler.
+void handle_sigprof(int /*signal*/)
+{
+    int const saved_errno = errno;
+
+    if (auto* buffer = g_active_buffer.load(std::memory_order_acquire))
+    {
+        auto const index = buffer->next_sample.fetch_add(1, std::memory_order_relaxed);
+        if (index < max_samples)
+        {
+            auto& s   = buffer->samples[index];
+            s.context = buffer->context.load(std::memory_order_relaxed);
+            s.depth   = static_cast<std::uint32_t>(::backtrace(s.frames.data(), static_cast<int>(max_frames)));
+        }
+        else
+            buffer->dropped_samples.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    errno = saved_errno;
+}
+
+auto symbolize(void* address, char const* symbol) -> std::string
+{
+    // glibc formats symbols as "module(mangled+offset) [address]"
+    std::string_view const sv{symbol};
+
+    auto const open  = sv.find('(');
+    auto const plus  = sv.find('+', open);
+    auto const close = sv.find(')', open);
+    if (open != std::string_view::npos && plus != std::string_view::npos && plus > open + 1 && plus < close)
+    {
+        std::string const mangled{sv.substr(open + 1, plus - open - 1)};
+
+        int   status    = 0;
+        char* demangled = abi::__cxa_demangle(mangled.c_str(), nullptr, nullptr, &status);
+        if (status == 0 && demangled != nullptr)
+        {
+            std::string result{demangled};
+            std::free(demangled); // NOLINT(cppcoreguidelines-no-malloc)
+            return result;
+        }
+        return mangled;
+    }
+
+    if (open != std::string_view::npos && close != std::string_view::npos)
+    {
+        auto module = sv.substr(0, open);
+        if (auto const slash = module.rfind('/'); slash != std::string_view::npos)
+            module.remove_prefix(slash + 1);
+        return std::string{module} + std::string{sv.substr(open + 1, close - open - 1)};
+    }
+
+    std::array<char, 2 + 2 * sizeof(void*) + 1> buffer{};
+    std::snprintf(buffer.data(), buffer.size(), "%p", address);
+    return buffer.data();
+}
+#endif
+} // namespace
+
+struct sampling_profiler::sample_buffer : sample_storage
+{
+    bool active = false;
+#if BUGSPRAY_HAS_SAMPLING_PROFILER
+    struct sigaction previous_action{};
+#endif
+};
+
+sampling_profiler::sampling_profiler(std::ostream& stream, std::chrono::microseconds interval)
+    : m_stream(stream)
+    , m_buffer(std::make_unique<sample_buffer>())
+{
+    m_contexts.emplace_back(outside_test_cases);
+
+#if BUGSPRAY_HAS_SAMPLING_PROFILER
+    std::array<void*, 1> prime{};
+    ::backtrace(prime.data(), static_cast<int>(prime.size()));
+
+    sample_storage* expected = nullptr;
+    if (!g_active_buffer.compare_exchange_strong(expected, m_buffer.get()))
+        return; // Another profiler is already running
+
+    struct sigaction action{};
+    action.sa_handler = &handle_sigprof;
+    action.sa_flags   = SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGPROF, &action, &m_buffer->previous_action);
+
+    auto const seconds = std::chrono::duration_cast<std::chrono::seconds>(interval);
+
+    itimerval timer{};
+    timer.it_interval.tv_sec  = seconds.count();
+    timer.it_interval.tv_usec = (interval - seconds).count();
+    timer.it_value            = timer.it_interval;
+    setitimer(ITIMER_PROF, &timer, nullptr);
+
+    m_buffer->active = true;
+#else
+    static_cast<void>(interval);
+#endif
+}
+
+sampling_profiler::~sampling_profiler()
+{
+    stop_sampling();
+}
+
+auto sampling_profiler::is_supported() noexcept -> bool
+{
+    return BUGSPRAY_HAS_SAMPLING_PROFILER != 0;
+}
+
+void sampling_profiler::enter_test_case(std::string_view name,
+                                        std::span<std::string_view const> /*tags*/,
+                                        source_location /*sloc*/) noexcept
+{
+    m_test_case = name;
+    m_sections.clear();
+    update_context();
+}
+
+void sampling_profiler::leave_test_case() noexcept
+{
+    m_test_case = {};
+    m_sections.clear();
+    update_context();
+}
+
+void sampling_profiler::start_run() noexcept {}
+
+void sampling_profiler::stop_run() noexcept {}
+
+void sampling_profiler::log_target(section_path const& /*target*/) noexcept {}
+
+void sampling_profiler::log_benchmark(benchmark_result const& /*result*/) noexcept {}
+
+void sampling_profiler::log_metric(std::string_view /*name*/,
+                                   double           /*value*/,
+                                   std::string_view /*unit*/) noexcept
+{
+}
+
+void sampling_profiler::enter_section(std::string_view name, source_location /*sloc*/) noexcept
+{
+    m_sections.push_back(sanitize_frame(std::string{name}));
+    update_context();
+}
+
+void sampling_profiler::leave_section() noexcept
+{
+    m_sections.pop_back();
+    update_context();
+}
+
+void sampling_profiler::log_assertion(std::string_view /*assertion*/,
+                                      source_location /*sloc*/,
+                                      std::string_view /*expansion*/,
+                                      std::span<bs::string const> /*messages*/,
+                                      bool /*result*/) noexcept
+{
+}
+
+auto sampling_profiler::needs_passed_assertions() const noexcept -> bool
+{
+    return false;
+}
+
+void sampling_profiler::log_passed_assertions(std::size_t /*count*/) noexcept
+{
+}
+
+void sampling_profiler::finalize() noexcept
+{
+    stop_sampling();
+
+#if BUGSPRAY_HAS_SAMPLING_PROFILER
+    auto const num_samples = std::min(m_buffer->next_sample.load(), max_samples);
+    auto const samples     = std::span{m_buffer->samples.get(), num_samples};
+
+    std::map<void*, std::string> symbols;
+    for (auto&& s : samples)
+        for (std::size_t i = skipped_frames; i < s.depth; ++i)
+            symbols.try_emplace(s.frames[i]);
+
+    std::vector<void*> addresses;
+    addresses.reserve(symbols.size());
+    for (auto&& [address, _] : symbols)
+        addresses.push_back(address);
+
+    if (!addresses.empty())
+    {
+        char** raw_symbols = ::backtrace_symbols(addresses.data(), static_cast<int>(addresses.size()));
+        for (std::size_t i = 0; i < addresses.size(); ++i)
+            symbols[addresses[i]] = sanitize_frame(raw_symbols != nullptr ? symbolize(addresses[i], raw_symbols[i])
+                                                                          : symbolize(addresses[i], ""));
+        std::free(raw_symbols); // NOLINT(cppcoreguidelines-no-malloc)
+    }
+
+    std::map<std::string, std::size_t> folded_stacks;
+    for (auto&& s : samples)
+    {
+        std::string stack = m_contexts[s.context];
+        for (std::size_t i = s.depth; i > skipped_frames; --i)
+            stack += ";" + symbols[s.frames[i - 1]];
+        ++folded_stacks[stack];
+    }
+
+    for (auto&& [stack, count] : folded_stacks)
+        m_stream << stack << ' ' << count << '\n';
+
+    if (auto const dropped = m_buffer->dropped_samples.load(); dropped > 0)
+        m_stream << outside_test_cases << ";(dropped samples) " << dropped << '\n';
+#endif
+    m_stream.flush();
+}
+
+void sampling_profiler::update_context()
+{
+    std::string context{m_test_case.empty() ? outside_test_cases : sanitize_frame(std::string{m_test_case})};
+    for (auto&& s : m_sections)
+        context += ";" + s;
+
+    auto [iter, inserted] = m_context_ids.try_emplace(context, static_cast<std::uint32_t>(m_contexts.size()));
+    if (inserted)
+        m_contexts.push_back(std::move(context));
+
+    m_buffer->context.store(iter->second, std::memory_order_relaxed);
+}
+
+void sampling_profiler::stop_sampling()
+{
+#if BUGSPRAY_HAS_SAMPLING_PROFILER
+    if (!std::exchange(m_buffer->active, false))
+        return;
+
+    itimerval const disarm{};
+    setitimer(ITIMER_PROF, &disarm, nullptr);
+    sigaction(SIGPROF, &m_buffer->previous_action, nullptr);
+    g_active_buffer.store(nullptr, std::memory_order_release);
+#endif
+}
+} // namespace bs
@@ -0,0 +1,170 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "bugspray/reporter/section_waste_reporter.hpp"
+
+#include <algorithm>
+#include <iomanip>
+
+namespace bs
+{
+section_waste_reporter::section_waste_reporter(std::ostream& stream)
+    : m_stream(stream)
+{
+}
+
+void section_waste_reporter::enter_test_case(std::string_view name,
+                                             std::span<std::string_view const> /*tags*/,
+                                             source_location /*sloc*/) noexcept
+{
+    m_current  = test_case_waste{.name = std::string{name}};
+    m_topology = test_case_topology{};
+    m_nodes.clear();
+}
+
+void section_waste_reporter::leave_test_case() noexcept
+{
+    // Of the time spent in a node, one execution is necessary. The others could be saved by restructuring.
+    for (auto&& [_, n] : m_nodes)
+    {
+        auto const runs = static_cast<duration::rep>(n.runs);
+        if (runs > 1)
+            m_current.waste += n.self_time * (runs - 1) / runs;
+    }
+
+    m_current.leaves = m_topology.leaf_count();
+    m_test_cases.push_back(std::move(m_current));
+}
+
+void section_waste_reporter::start_run() noexcept
+{
+    ++m_current.runs;
+    open({});
+}
+
+void section_waste_reporter::stop_run() noexcept
+{
+    m_current.runtime += close();
+}
+
+void section_waste_reporter::log_target(section_path const& /*target*/) noexcept {}
+
+void section_waste_reporter::log_benchmark(benchmark_result const& /*result*/) noexcept {}
+
+void section_waste_reporter::log_metric(std::string_view /*name*/,
+                                        double           /*value*/,
+                                        std::string_view /*unit*/) noexcept
+{
+}
+
+void section_waste_reporter::enter_section(std::string_view name, source_location /*sloc*/) noexcept
+{
+    m_current_path.push_back(bs::string{name});
+    m_topology.chart(m_current_path);
+
+    // Section names cannot contain a NUL, so it serves as an unambiguous separator
+    auto key = m_open_nodes.back().key;
+    key += '\0';
+    key += name;
+    open(std::move(key));
+}
+
+void section_waste_reporter::leave_section() noexcept
+{
+    close();
+    m_current_path.pop_back();
+}
+
+void section_waste_reporter::log_assertion(std::string_view /*assertion*/,
+                                           source_location /*sloc*/,
+                                           std::string_view /*expansion*/,
+                                           std::span<bs::string const> /*messages*/,
+                                           bool /*result*/) noexcept
+{
+}
+
+auto section_waste_reporter::needs_passed_assertions() const noexcept -> bool
+{
+    return false;
+}
+
+void section_waste_reporter::log_passed_assertions(std::size_t /*count*/) noexcept
+{
+}
+
+void section_waste_reporter::finalize() noexcept
+{
+    using milliseconds = std::chrono::duration<double, std::milli>;
+
+    std::ranges::stable_sort(m_test_cases, std::ranges::greater{}, &test_case_waste::waste);
+
+    std::size_t name_width = std::string_view{"test case"}.size();
+    for (auto&& tc : m_test_cases)
+        name_width = std::max(name_width, tc.name.size());
+
+    auto const flags = m_stream.flags();
+
+    m_stream << "\nSection re-execution waste [ms]:\n";
+    m_stream << std::left << std::setw(static_cast<int>(name_width)) << "test case" << std::right
+             << "  leaves    runs     runtime       waste   share\n";
+    m_stream << std::fixed << std::setprecision(3);
+    for (auto&& tc : m_test_cases)
+    {
+        auto const share = tc.runtime.count() > 0 ? 100. * milliseconds{tc.waste} / milliseconds{tc.runtime} : 0.;
+        m_stream << std::left << std::setw(static_cast<int>(name_width)) << tc.name << std::right;
+        m_stream << "  " << std::setw(6) << tc.leaves << "  " << std::setw(6) << tc.runs;
+        m_stream << "  " << std::setw(10) << milliseconds{tc.runtime}.count();
+        m_stream << "  " << std::setw(10) << milliseconds{tc.waste}.count();
+        m_stream << "  " << std::setw(5) << std::setprecision(1) << share << '%' << std::setprecision(3) << '\n';
+    }
+
+    m_stream.flags(flags);
+    m_stream.flush();
+}
+
+void section_waste_reporter::open(std::string key)
+{
+    m_stopwatch.start_section_timer();
+    m_open_nodes.push_back({.key = std::move(key)});
+}
+
+auto section_waste_reporter::close() -> duration
+{
+    auto const elapsed = m_stopwatch.stop_section_timer();
+    auto const node    = std::move(m_open_nodes.back());
+    m_open_nodes.pop_back();
+
+    auto& data = m_nodes[node.key];
+    data.self_time += elapsed - node.children_time;
+    if (data.runs == 0 || data.last_run != m_current.runs)
+    {
+        ++data.runs;
+        data.last_run = m_current.runs;
+    }
+
+    if (!m_open_nodes.empty())
+        m_open_nodes.back().children_time += elapsed;
+
+    return elapsed;
+}
+} // namespace bs
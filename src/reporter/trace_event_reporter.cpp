@@ -0,0 +1,233 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "bugspray/reporter/trace_event_reporter.hpp"
+
+#include <cmath>
+#include <functional>
+#include <iomanip>
+#include <thread>
+#include <utility>
+
+#if __has_include(<unistd.h>)
+    #include <unistd.h>
+#endif
+
+namespace bs
+{
+namespace
+{
+auto current_pid() -> long
+{
+#if __has_include(<unistd.h>)
+    return static_cast<long>(::getpid());
+#else
+    return 1;
+#endif
+}
+} // namespace
+
+trace_event_reporter::trace_event_reporter(std::ostream& stream)
+    : m_stream(stream)
+    , m_epoch(std::chrono::steady_clock::now())
+    , m_tid(std::hash<std::thread::id>{}(std::this_thread::get_id()) & 0xFFFF'FFFFu)
+{
+    m_stream << R"({"displayTimeUnit":"ms","traceEvents":[)";
+}
+
+void trace_event_reporter::enter_test_case(std::string_view                  name,
+                                           std::span<std::string_view const> tags,
+                                           source_location                   sloc) noexcept
+{
+    begin_event('B', name, "test_case");
+    m_stream << R"(,"args":{"file":)";
+    write_string(sloc.file_name);
+    m_stream << R"(,"line":)" << sloc.line << R"(,"tags":[)";
+    for (bool first = true; auto&& t : tags)
+    {
+        if (!std::exchange(first, false))
+            m_stream << ',';
+        write_string(t);
+    }
+    m_stream << "]}}";
+
+    m_run_index = 0;
+}
+
+void trace_event_reporter::leave_test_case() noexcept
+{
+    begin_event('E', {}, "test_case");
+    m_stream << '}';
+}
+
+void trace_event_reporter::start_run() noexcept
+{
+    m_passed_assertions = 0;
+    m_failed_assertions = 0;
+
+    begin_event('B', "run", "run");
+    m_stream << R"(,"args":{"index":)" << m_run_index++ << "}}";
+}
+
+void trace_event_reporter::stop_run() noexcept
+{
+    begin_event('E', {}, "run");
+    m_stream << '}';
+
+    begin_event('C', "assertions", "run");
+    m_stream << R"(,"args":{"passed":)" << m_passed_assertions << R"(,"failed":)" << m_failed_assertions << "}}";
+}
+
+void trace_event_reporter::log_target(section_path const& /*target*/) noexcept
+{
+}
+
+void trace_event_reporter::log_benchmark(benchmark_result const& result) noexcept
+{
+    begin_event('i', result.name, "benchmark");
+    m_stream << R"(,"s":"t","args":{"mean_ns":)" << result.mean.point << R"(,"mean_lower_bound_ns":)"
+             << result.mean.lower_bound << R"(,"mean_upper_bound_ns":)" << result.mean.upper_bound
+             << R"(,"standard_deviation_ns":)" << result.standard_deviation.point << R"(,"samples":)" << result.samples
+             << R"(,"iterations":)" << result.iterations;
+    if (result.comparison)
+        m_stream << R"(,"baseline_mean_ns":)" << result.comparison->baseline_mean << R"(,"change":)"
+                 << result.comparison->change << R"(,"p_value":)" << result.comparison->p_value << R"(,"regression":)"
+                 << (result.comparison->regression ? "true" : "false");
+    m_stream << "}}";
+}
+
+void trace_event_reporter::log_metric(std::string_view name, double value, std::string_view unit) noexcept
+{
+    begin_event('i', name, "metric");
+    m_stream << R"(,"s":"t","args":{"value":)";
+    if (std::isfinite(value))
+        m_stream << value;
+    else
+        m_stream << "null";
+    m_stream << R"(,"unit":)";
+    write_string(unit);
+    m_stream << "}}";
+}
+
+void trace_event_reporter::enter_section(std::string_view name, source_location sloc) noexcept
+{
+    begin_event('B', name, "section");
+    m_stream << R"(,"args":{"file":)";
+    write_string(sloc.file_name);
+    m_stream << R"(,"line":)" << sloc.line << "}}";
+}
+
+void trace_event_reporter::leave_section() noexcept
+{
+    begin_event('E', {}, "section");
+    m_stream << '}';
+}
+
+void trace_event_reporter::log_assertion(std::string_view            assertion,
+                                         source_location             sloc,
+                                         std::string_view            expansion,
+                                         std::span<bs::string const> messages,
+                                         bool                        result) noexcept
+{
+    if (result)
+    {
+        ++m_passed_assertions;
+        return;
+    }
+    ++m_failed_assertions;
+
+    begin_event('i', "assertion failed", "assertion");
+    m_stream << R"(,"s":"t","args":{"expression":)";
+    write_string(assertion);
+    m_stream << R"(,"expansion":)";
+    write_string(expansion);
+    m_stream << R"(,"file":)";
+    write_string(sloc.file_name);
+    m_stream << R"(,"line":)" << sloc.line << R"(,"messages":[)";
+    for (bool first = true; auto&& msg : messages)
+    {
+        if (!std::exchange(first, false))
+            m_stream << ',';
+        write_string(std::string_view{msg});
+    }
+    m_stream << "]}}";
+}
+
+auto trace_event_reporter::needs_passed_assertions() const noexcept -> bool
+{
+    return false;
+}
+
+void trace_event_reporter::log_passed_assertions(std::size_t count) noexcept
+{
+    m_passed_assertions += count;
+}
+
+void trace_event_reporter::finalize() noexcept
+{
+    m_stream << "\n]}";
+    m_stream.flush();
+}
+
+void trace_event_reporter::begin_event(char phase, std::string_view name, std::string_view category)
+{
+    // Tests may leave the stream in a different base (e.g. when writing to std::cout)
+    m_stream << std::dec << (std::exchange(m_first_event, false) ? "\n" : ",\n");
+    m_stream << '{';
+    if (!name.empty())
+    {
+        m_stream << R"("name":)";
+        write_string(name);
+        m_stream << ',';
+    }
+    m_stream << R"("cat":")" << category << R"(","ph":")" << phase << R"(","ts":)";
+    write_timestamp();
+    m_stream << R"(,"pid":)" << current_pid() << R"(,"tid":)" << m_tid;
+}
+
+void trace_event_reporter::write_timestamp()
+{
+    auto const ns   = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_epoch);
+    auto const fill = m_stream.fill('0');
+    m_stream << ns.count() / 1000 << '.' << std::setw(3) << ns.count() % 1000;
+    m_stream.fill(fill);
+}
+
+void trace_event_reporter::write_string(std::string_view str)
+{
+    constexpr std::string_view hex_digits = "0123456789abcdef";
+
+    m_stream << '"';
+    for (char const c : str)
+    {
+        auto const uc = static_cast<unsigned char>(c);
+        if (c == '"' || c == '\\')
+            m_stream << '\\' << c;
+        else if (uc < 0x20)
+            m_stream << "\\u00" << hex_digits[uc >> 4] << hex_digits[uc & 0xF];
+        else
+            m_stream << c;
+    }
+    m_stream << '"';
+}
+} // namespace bs
@@ -69,7 +69,7 @@ void xml_reporter::enter_test_case(std::string_view                  name,
 
 void xml_reporter::leave_test_case() noexcept
 {
-    auto const duration = m_stopwatch.stop_test_case_timer();
+    auto const duration = std::chrono::duration<double>{m_stopwatch.stop_test_case_timer()};
 
     if (m_failed)
         ++m_results_test_cases.failures;
@@ -78,13 +78,15 @@ void xml_reporter::leave_test_case() noexcept
 
     for (auto&& s : m_section_root.sections)
         write_section(s);
-    results r;
+    write_benchmarks(m_section_root.benchmarks);
+    write_metrics(m_section_root.metrics);
+    results r{.successes = m_section_root.passed_assertions};
     write_assertions(r, m_section_root.assertions);
 
     m_writer.open_element("OverallResult");
     m_writer.write_attribute("success", m_failed ? "false" : "true");
     if (m_report_timings)
-        m_writer.write_attribute("durationInSeconds", std::string_view{to_string(duration.count() / 1000.)});
+        m_writer.write_attribute("durationInSeconds", std::string_view{to_string(duration.count())});
     m_writer.close_attribute_and_element();
 
     m_writer.close_element();
@@ -99,7 +101,7 @@ void xml_reporter::start_run() noexcept
 
 void xml_reporter::stop_run() noexcept
 {
-    current_data().runtime_in_seconds = m_stopwatch.stop_section_timer().count() / 1000.;
+    current_data().runtime_in_seconds = std::chrono::duration<double>{m_stopwatch.stop_section_timer()}.count();
     m_current_target.reset();
 }
 
@@ -108,6 +110,16 @@ void xml_reporter::log_target(section_path const& target) noexcept
     m_current_target = target;
 }
 
+void xml_reporter::log_benchmark(benchmark_result const& result) noexcept
+{
+    current_data().benchmarks.push_back({bs::string{result.name}, result});
+}
+
+void xml_reporter::log_metric(std::string_view name, double value, std::string_view unit) noexcept
+{
+    current_data().metrics.push_back({bs::string{name}, value, bs::string{unit}});
+}
+
 void xml_reporter::enter_section(std::string_view name, source_location sloc) noexcept
 {
     m_current_path.push_back(bs::string{name});
@@ -145,6 +157,17 @@ void xml_reporter::log_assertion(std::string_view            assertion,
     });
 }
 
+auto xml_reporter::needs_passed_assertions() const noexcept -> bool
+{
+    return false;
+}
+
+void xml_reporter::log_passed_assertions(std::size_t count) noexcept
+{
+    m_total_results.successes += count;
+    current_data().passed_assertions += count;
+}
+
 void xml_reporter::finalize() noexcept
 {
     m_writer.open_element("OverallResults");
@@ -193,8 +216,10 @@ void xml_reporter::write_section(section_data const& sd)
 
     for (auto&& sub : sd.sections)
         write_section(sub);
+    write_benchmarks(sd.benchmarks);
+    write_metrics(sd.metrics);
 
-    results r;
+    results r{.successes = sd.passed_assertions};
     write_assertions(r, sd.assertions);
 
     m_writer.open_element("OverallResults");
@@ -209,6 +234,68 @@ void xml_reporter::write_section(section_data const& sd)
     m_writer.close_element();
 }
 
+void xml_reporter::write_benchmarks(bs::vector<benchmark_data> const& bd)
+{
+    for (auto&& [name, result] : bd)
+    {
+        m_writer.open_element("BenchmarkResults");
+        m_writer.write_attribute("name", name);
+        m_writer.write_attribute("samples", std::string_view{to_string(result.samples)});
+        m_writer.write_attribute("resamples", std::string_view{to_string(result.resamples)});
+        m_writer.write_attribute("iterations", std::string_view{to_string(result.iterations)});
+        m_writer.write_attribute("clockResolution", std::string_view{to_string(result.clock_resolution)});
+        m_writer.write_attribute("estimatedDuration", std::string_view{to_string(result.estimated_duration)});
+        m_writer.close_attribute_section();
+
+        write_estimate("mean", result.mean);
+        write_estimate("standardDeviation", result.standard_deviation);
+
+        m_writer.open_element("outliers");
+        m_writer.write_attribute("variance", std::string_view{to_string(result.outlier_variance)});
+        m_writer.write_attribute("lowMild", std::string_view{to_string(result.outliers.low_mild)});
+        m_writer.write_attribute("lowSevere", std::string_view{to_string(result.outliers.low_severe)});
+        m_writer.write_attribute("highMild", std::string_view{to_string(result.outliers.high_mild)});
+        m_writer.write_attribute("highSevere", std::string_view{to_string(result.outliers.high_severe)});
+        m_writer.close_attribute_and_element();
+
+        if (result.comparison)
+        {
+            auto const& cmp = *result.comparison;
+            m_writer.open_element("baseline");
+            m_writer.write_attribute("mean", std::string_view{to_string(cmp.baseline_mean)});
+            m_writer.write_attribute("change", std::string_view{to_string(cmp.change)});
+            m_writer.write_attribute("pValue", std::string_view{to_string(cmp.p_value)});
+            m_writer.write_attribute("threshold", std::string_view{to_string(cmp.threshold)});
+            m_writer.write_attribute("regression", std::string_view{to_string(cmp.regression)});
+            m_writer.close_attribute_and_element();
+        }
+
+        m_writer.close_element();
+    }
+}
+
+void xml_reporter::write_metrics(bs::vector<metric_data> const& md)
+{
+    for (auto&& [name, value, unit] : md)
+    {
+        m_writer.open_element("Metric");
+        m_writer.write_attribute("name", name);
+        m_writer.write_attribute("value", std::string_view{to_string(value)});
+        m_writer.write_attribute("unit", unit);
+        m_writer.close_attribute_and_element();
+    }
+}
+
+void xml_reporter::write_estimate(std::string_view tag, benchmark_estimate const& estimate)
+{
+    m_writer.open_element(tag);
+    m_writer.write_attribute("value", std::string_view{to_string(estimate.point)});
+    m_writer.write_attribute("lowerBound", std::string_view{to_string(estimate.lower_bound)});
+    m_writer.write_attribute("upperBound", std::string_view{to_string(estimate.upper_bound)});
+    m_writer.write_attribute("ci", std::string_view{to_string(estimate.confidence_interval)});
+    m_writer.close_attribute_and_element();
+}
+
 void xml_reporter::write_assertions(results& r, bs::vector<assertion_data> const& ad)
 {
     for (auto&& a : ad)
@@ -0,0 +1,83 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "bugspray/bugspray.hpp"
+#include "bugspray/reporter/noop_reporter.hpp"
+
+/*
+ * Measures the cost of assertions and captures, by running a test case that consists of nothing else under a
+ * noop_reporter. Each benchmark evaluates assertions_per_run of them, including the setup of a single test run.
+ */
+
+namespace
+{
+constexpr int assertions_per_run = 1000;
+
+void passing_checks(bs::test_run_data& bugspray_data)
+{
+    for (int i = 0; i < assertions_per_run; ++i)
+        CHECK(i >= 0);
+}
+
+void failing_checks(bs::test_run_data& bugspray_data)
+{
+    for (int i = 0; i < assertions_per_run; ++i)
+        CHECK(i < 0);
+}
+
+void captures(bs::test_run_data& bugspray_data)
+{
+    for (int i = 0; i < assertions_per_run; ++i)
+    {
+        CAPTURE(i);
+    }
+}
+
+auto evaluate(bs::test_case_fn fn) -> bool
+{
+    bs::test_case const tc{
+        .name            = "benchmarked",
+        .tags            = {},
+        .source_location = BUGSPRAY_THIS_LOCATION(),
+        .test_fn         = fn,
+    };
+    bs::noop_reporter the_reporter;
+    return bs::evaluate_test_case(tc, the_reporter);
+}
+} // namespace
+
+TEST_CASE("assertions", "[benchmarks]", runtime)
+{
+    BENCHMARK("CHECK passing x1000")
+    {
+        return evaluate(&passing_checks);
+    };
+    BENCHMARK("CHECK failing x1000")
+    {
+        return evaluate(&failing_checks);
+    };
+    BENCHMARK("CAPTURE x1000")
+    {
+        return evaluate(&captures);
+    };
+}
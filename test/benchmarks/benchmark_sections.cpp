@@ -0,0 +1,119 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "bugspray/bugspray.hpp"
+#include "bugspray/reporter/noop_reporter.hpp"
+
+#include <string>
+
+/*
+ * Measures entering and leaving sections during test evaluation, and charting the topology of wide and deep section
+ * trees in isolation.
+ */
+
+namespace
+{
+constexpr int section_iterations = 100;
+constexpr int wide_tree_width    = 1000;
+constexpr int deep_tree_depth    = 100;
+
+void sections_in_loop(bs::test_run_data& bugspray_data)
+{
+    for (int i = 0; i < section_iterations; ++i)
+    {
+        SECTION("a")
+        {
+            bs::keep_value(i);
+        }
+        SECTION("b")
+        {
+            for (int j = 0; j < section_iterations; ++j)
+            {
+                SECTION("b.c")
+                {
+                    bs::keep_value(j);
+                }
+            }
+        }
+    }
+}
+
+auto make_name(int i) -> bs::string
+{
+    return bs::string{std::to_string(i)};
+}
+} // namespace
+
+TEST_CASE("sections", "[benchmarks]", runtime)
+{
+    BENCHMARK("SECTION in loops")
+    {
+        bs::test_case const tc{
+            .name            = "benchmarked",
+            .tags            = {},
+            .source_location = BUGSPRAY_THIS_LOCATION(),
+            .test_fn         = &sections_in_loop,
+        };
+        bs::noop_reporter the_reporter;
+        return bs::evaluate_test_case(tc, the_reporter);
+    };
+}
+
+TEST_CASE("test_case_topology", "[benchmarks]", runtime)
+{
+    BENCHMARK_ADVANCED("chart wide tree")(bs::chronometer meter)
+    {
+        bs::vector<bs::section_path> paths;
+        for (int i = 0; i < wide_tree_width; ++i)
+            paths.push_back(bs::section_path{make_name(i)});
+
+        meter.measure(
+            [&]
+            {
+                bs::test_case_topology topology;
+                for (auto const& path : paths)
+                    topology.chart(path);
+                return topology.node_count();
+            });
+    };
+
+    BENCHMARK_ADVANCED("chart deep tree")(bs::chronometer meter)
+    {
+        bs::vector<bs::section_path> paths;
+        bs::section_path             path;
+        for (int i = 0; i < deep_tree_depth; ++i)
+        {
+            path.push_back(make_name(i));
+            paths.push_back(path);
+        }
+
+        meter.measure(
+            [&]
+            {
+                bs::test_case_topology topology;
+                for (auto const& p : paths)
+                    topology.chart(p);
+                return topology.node_count();
+            });
+    };
+}
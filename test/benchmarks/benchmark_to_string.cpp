@@ -0,0 +1,75 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "bugspray/bugspray.hpp"
+#include "bugspray/to_string/stringify.hpp"
+
+#include <numeric>
+#include <string_view>
+#include <vector>
+
+/*
+ * Measures stringification of the types most commonly found in assertion expansions.
+ */
+
+namespace
+{
+constexpr int values_per_run = 100;
+} // namespace
+
+TEST_CASE("to_string", "[benchmarks]", runtime)
+{
+    BENCHMARK_ADVANCED("to_string integers x100")(bs::chronometer meter)
+    {
+        std::vector<long long> values(values_per_run);
+        for (int i = 0; i < values_per_run; ++i)
+            values[static_cast<std::size_t>(i)] = (i % 2 == 0 ? -1LL : 1LL) * i * i * i * i * i;
+
+        meter.measure(
+            [&]
+            {
+                std::size_t length = 0;
+                for (auto const value : values)
+                    length += bs::stringify(value).size();
+                return length;
+            });
+    };
+
+    BENCHMARK("to_string strings x100")
+    {
+        constexpr std::string_view value = "the quick brown fox\tjumps over the \"lazy\" dog\n";
+
+        std::size_t length = 0;
+        for (int i = 0; i < values_per_run; ++i)
+            length += bs::stringify(value).size();
+        return length;
+    };
+
+    BENCHMARK_ADVANCED("to_string vector of 100 ints")(bs::chronometer meter)
+    {
+        std::vector<int> values(values_per_run);
+        std::iota(values.begin(), values.end(), 0);
+
+        meter.measure([&] { return bs::stringify(values); });
+    };
+}
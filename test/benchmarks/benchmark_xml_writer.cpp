@@ -0,0 +1,86 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "bugspray/bugspray.hpp"
+#include "bugspray/utility/xml_writer.hpp"
+
+#include <chrono>
+#include <sstream>
+#include <string>
+
+/*
+ * Measures the throughput of the xml_writer with a document shaped like the output of the xml reporter. Besides the
+ * time per document, the throughput in bytes per second is reported as metric.
+ */
+
+namespace
+{
+constexpr int elements_per_document  = 100;
+constexpr int throughput_repetitions = 100;
+
+auto write_document() -> std::size_t
+{
+    std::ostringstream ss;
+    {
+        bs::xml_writer xml{ss};
+        xml.open_element("Catch2TestRun");
+        xml.write_attribute("name", "bugspray-benchmarks");
+        xml.close_attribute_section();
+        for (int i = 0; i < elements_per_document; ++i)
+        {
+            xml.open_element("Expression");
+            xml.write_attribute("success", "false");
+            xml.write_attribute("filename", "/projects/bugspray/test/benchmarks/benchmark_xml_writer.cpp");
+            xml.write_attribute("line", "42");
+            xml.close_attribute_section();
+            xml.open_element("Original");
+            xml.close_attribute_section();
+            xml.write_content("a < b && \"escaped\" != 'text'");
+            xml.close_element();
+            xml.close_element();
+        }
+        xml.close_element();
+    }
+    return ss.str().size();
+}
+} // namespace
+
+TEST_CASE("xml_writer", "[benchmarks]", runtime)
+{
+    BENCHMARK("xml_writer document")
+    {
+        return write_document();
+    };
+
+    SECTION("throughput")
+    {
+        std::size_t bytes = 0;
+
+        auto const start = std::chrono::steady_clock::now();
+        for (int i = 0; i < throughput_repetitions; ++i)
+            bytes += write_document();
+        std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - start;
+
+        REPORT_METRIC("xml_writer throughput", static_cast<double>(bytes) / elapsed.count() / 1e6, "MB/s");
+    }
+}
@@ -0,0 +1,96 @@
+import argparse
+import json
+import os
+import pathlib
+import subprocess
+import time
+
+# Every sweep varies one parameter of the generated translation unit, while the others keep their default value.
+DEFAULTS = {'test_cases': 1, 'assertions': 10, 'sections': 0, 'captures': 0, 'dynamic_sections': 0}
+SWEEPS = {
+    'test_cases': [1, 2, 4, 8, 16],
+    'assertions': [10, 50, 100, 200, 400],
+    'sections': [1, 2, 4, 6, 8],
+    'captures': [1, 2, 4, 8, 16],
+    'dynamic_sections': [1, 2, 4, 8, 16],
+}
+
+parser = argparse.ArgumentParser(description='Measure compile time and peak memory of constexpr test evaluation')
+parser.add_argument('--compiler', type=str, action='append', required=True, help='compiler to use, may be repeated')
+parser.add_argument('--output', type=str, required=True, help='directory for generated files and results')
+parser.add_argument('--sweep', type=str, action='append', choices=SWEEPS.keys(), help='only run the given sweeps')
+parser.add_argument('flags', nargs='*', help='compiler flags after --, e.g. include directories')
+
+args = parser.parse_args()
+
+
+def nested_sections(depth):
+    # every level holds a leaf section next to the nested one, so a test case with depth d is run d + 1 times
+    if depth == 0:
+        return 'CHECK(value == 0);'
+    return (f'SECTION("leaf {depth}") {{ CHECK(value == 0); }}\n'
+            f'    SECTION("nested {depth}") {{ {nested_sections(depth - 1)} }}')
+
+
+def generate_test_case(index, assertions, sections, captures, dynamic_sections):
+    body = ['int value = 0;']
+    body += ['CAPTURE(value);'] * captures
+    body += [f'CHECK(value <= {i});' for i in range(assertions)]
+    if sections > 0:
+        body.append(nested_sections(sections))
+    body += [f'DYNAMIC_SECTION("dynamic " + bs::structural_string{{"{i}"}}) {{ CHECK(value <= {i}); }}'
+             for i in range(dynamic_sections)]
+    lines = '\n    '.join(body)
+    return f'TEST_CASE("test case {index}")\n{{\n    {lines}\n}}\nEVAL_TEST_CASE("test case {index}");\n'
+
+
+def generate_translation_unit(test_cases, **kwargs):
+    test_case_definitions = [generate_test_case(i, **kwargs) for i in range(test_cases)]
+    return '#include "bugspray/bugspray.hpp"\n\n' + '\n'.join(test_case_definitions)
+
+
+def is_clang(compiler):
+    version = subprocess.run([compiler, '--version'], capture_output=True, text=True).stdout
+    return 'clang' in version
+
+
+def compile_translation_unit(compiler, source):
+    obj = source.with_suffix('.o')
+    command = [compiler, *args.flags, '-c', str(source), '-o', str(obj)]
+    if is_clang(compiler):
+        # writes the trace next to the object file, to be opened in chrome://tracing or speedscope
+        command.append('-ftime-trace')
+
+    with open(source.with_suffix('.log'), 'w') as log:
+        start = time.perf_counter()
+        process = subprocess.Popen(command, stdout=log, stderr=subprocess.STDOUT)
+        _, status, usage = os.wait4(process.pid, 0)
+        seconds = time.perf_counter() - start
+    # ru_maxrss is in kilobytes on Linux
+    return os.waitstatus_to_exitcode(status) == 0, seconds, usage.ru_maxrss
+
+
+output = pathlib.Path(args.output)
+output.mkdir(parents=True, exist_ok=True)
+
+results = []
+for compiler in args.compiler:
+    compiler_name = pathlib.Path(compiler).name
+    for sweep in args.sweep or SWEEPS.keys():
+        print(f'{compiler_name}, {sweep}:')
+        print(f'{"size":>6} {"time [s]":>10} {"memory [MB]":>12}')
+        for size in SWEEPS[sweep]:
+            parameters = dict(DEFAULTS, **{sweep: size})
+            source = output / f'{compiler_name}_{sweep}_{size}.cpp'
+            source.write_text(generate_translation_unit(**parameters))
+
+            # a failure usually means that a limit of the constexpr evaluation was hit, which is a result as well
+            success, seconds, peak_memory = compile_translation_unit(compiler, source)
+            status = '' if success else f'  failed, see {source.with_suffix(".log")}'
+            print(f'{size:>6} {seconds:>10.2f} {peak_memory / 1024:>12.1f}{status}')
+            results.append({'compiler': compiler_name, 'sweep': sweep, 'size': size, 'parameters': parameters,
+                            'success': success, 'seconds': seconds, 'peak_memory_kb': peak_memory})
+        print()
+
+with open(output / 'compile-time-benchmarks.json', 'w') as f:
+    json.dump({'results': results}, f, indent=2)
@@ -32,7 +32,6 @@ TEST_CASE("calling asserting functions")
 {
     CALL(test1);
 }
-EVAL_TEST_CASE("calling asserting functions");
 
 template<typename T>
 ASSERTING_FUNCTION(templated_function, (T a, T b))
@@ -44,4 +43,5 @@ TEST_CASE("calling templated asserting functions")
 {
     CALL(templated_function<int>, 1, 1);
 }
-EVAL_TEST_CASE("calling templated asserting functions");
\ No newline at end of file
+
+EVAL_ALL_TEST_CASES();
\ No newline at end of file
@@ -0,0 +1,91 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "bugspray/bugspray.hpp"
+
+#include <chrono>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+constexpr auto fib(int n) -> int
+{
+    return n < 2 ? n : fib(n - 1) + fib(n - 2);
+}
+
+TEST_CASE("fibonacci")
+{
+    CHECK(fib(10) == 55);
+
+    BENCHMARK("fib 10")
+    {
+        return fib(10);
+    };
+}
+EVAL_TEST_CASE("fibonacci");
+
+// Computes fibonacci iteratively, returning the number of loop iterations
+constexpr auto fib_iterations(std::size_t n) -> std::size_t
+{
+    std::size_t iterations = 0;
+    std::size_t a          = 0;
+    std::size_t b          = 1;
+    for (; iterations < n; ++iterations)
+        a = std::exchange(b, a + b);
+    return iterations;
+}
+
+TEST_CASE("fibonacci complexity")
+{
+    CHECK_COMPLEXITY(linear, 1024, fib_iterations);
+}
+EVAL_TEST_CASE("fibonacci complexity");
+
+TEST_CASE("accumulate", "", runtime)
+{
+    SECTION("throughput")
+    {
+        std::vector<int> v(1 << 20, 1);
+
+        auto const start = std::chrono::steady_clock::now();
+        bs::keep_value(std::accumulate(v.begin(), v.end(), 0));
+        std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - start;
+
+        REPORT_METRIC("accumulate throughput", static_cast<double>(v.size()) / elapsed.count() / 1e6, "Mint/s", > 0.);
+    }
+
+    BENCHMARK_ADVANCED("accumulate 1000")(bs::chronometer meter)
+    {
+        std::vector<int> v(1000);
+        std::iota(v.begin(), v.end(), 0);
+        meter.measure([&] { return std::accumulate(v.begin(), v.end(), 0); });
+    };
+
+    CHECK_COMPLEXITY(linear,
+                     1 << 14,
+                     [](std::size_t n)
+                     {
+                         std::vector<int> v(n, 1);
+                         bs::keep_value(std::accumulate(v.begin(), v.end(), 0));
+                     });
+}
@@ -0,0 +1,238 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#define BUGSPRAY_NO_SHORT_MACROS
+#include "bugspray/macro_interface/assertion_macros.hpp"
+#include "bugspray/macro_interface/benchmark_macros.hpp"
+#include "bugspray/macro_interface/section_macro.hpp"
+#include "bugspray/reporter/caching_reporter.hpp"
+#include "bugspray/test_evaluation/evaluate_test_case.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <sstream>
+
+using namespace bs;
+
+static constexpr void a_benchmarking_test_case_fn(test_run_data& bugspray_data)
+{
+    int value = 1;
+    BUGSPRAY_BENCHMARK("simple")
+    {
+        return value * 2;
+    };
+    BUGSPRAY_BENCHMARK_ADVANCED("advanced")(bs::chronometer meter)
+    {
+        int const local = value + 1;
+        meter.measure([&](int i) { return local + i; });
+    };
+    BUGSPRAY_REQUIRE(value == 1);
+}
+
+TEST_CASE("benchmark", "[benchmark]")
+{
+    constexpr test_case tc{
+        .name            = "foo",
+        .tags            = {},
+        .source_location = {"some_file.cpp", 42},
+        .test_fn         = &a_benchmarking_test_case_fn,
+    };
+    constexpr auto test = [=]()
+    {
+        caching_reporter the_reporter;
+        bool const       success = evaluate_test_case(tc, the_reporter);
+        return std::pair{success, the_reporter.cache()};
+    };
+
+    // Benchmarks are skipped during constant evaluation
+    STATIC_REQUIRE(test().first);
+    STATIC_REQUIRE(test().second[0].test_runs[0].benchmarks.size() == 0);
+    STATIC_REQUIRE(test().second[0].test_runs[0].assertions.size() == 1);
+
+    auto const previous_config = g_benchmark_config;
+    g_benchmark_config         = benchmark_config{
+                .samples     = 3,
+                .resamples   = 10,
+                .warmup_time = std::chrono::milliseconds{0},
+    };
+
+    SECTION("run at runtime")
+    {
+        auto const [success, cache] = test();
+        REQUIRE(success);
+        REQUIRE(cache[0].test_runs[0].assertions.size() == 1);
+        REQUIRE(cache[0].test_runs[0].benchmarks.size() == 2);
+        REQUIRE(cache[0].test_runs[0].benchmarks[0].name == "simple");
+        REQUIRE(cache[0].test_runs[0].benchmarks[1].name == "advanced");
+        for (auto&& b : cache[0].test_runs[0].benchmarks)
+        {
+            REQUIRE(b.result.samples == 3);
+            REQUIRE(b.result.resamples == 10);
+            REQUIRE(b.result.iterations >= 1);
+            REQUIRE(b.result.mean.point > 0.);
+            REQUIRE(b.result.outliers.samples_seen == 3);
+        }
+    }
+    SECTION("skipped")
+    {
+        g_benchmark_config.skip = true;
+
+        auto const [success, cache] = test();
+        REQUIRE(success);
+        REQUIRE(cache[0].test_runs[0].assertions.size() == 1);
+        REQUIRE(cache[0].test_runs[0].benchmarks.size() == 0);
+    }
+    SECTION("recorded")
+    {
+        benchmark_baseline recording;
+        g_benchmark_config.recording = &recording;
+
+        REQUIRE(test().first);
+        REQUIRE(recording.entries().size() == 2);
+        REQUIRE(recording.find("foo", {}, "simple") != nullptr);
+        REQUIRE(recording.find("foo", {}, "simple")->samples.size() == 3);
+        REQUIRE(recording.find("foo", {}, "advanced") != nullptr);
+    }
+    SECTION("compared to baseline")
+    {
+        benchmark_baseline baseline;
+        baseline.record({.test_case = "foo",
+                         .sections  = {},
+                         .name      = "simple",
+                         .mean      = 1e9,
+                         .samples   = {1e9, 1e9, 1e9}});
+        baseline.record({.test_case = "foo",
+                         .sections  = {},
+                         .name      = "advanced",
+                         .mean      = 1e-6,
+                         .samples   = {1e-6, 1e-6, 1e-6}});
+        g_benchmark_config.baseline = &baseline;
+
+        auto const [success, cache] = test();
+        REQUIRE_FALSE(success);
+
+        auto const& run = cache[0].test_runs[0];
+        REQUIRE(run.benchmarks[0].result.comparison.has_value());
+        REQUIRE_FALSE(run.benchmarks[0].result.comparison->regression);
+        REQUIRE(run.benchmarks[1].result.comparison.has_value());
+        REQUIRE(run.benchmarks[1].result.comparison->regression);
+
+        REQUIRE(run.assertions.size() == 3);
+        REQUIRE(run.assertions[0].text == "BENCHMARK(\"simple\")");
+        REQUIRE(run.assertions[0].result);
+        REQUIRE(run.assertions[1].text == "BENCHMARK_ADVANCED(\"advanced\")");
+        REQUIRE_FALSE(run.assertions[1].result);
+    }
+
+    g_benchmark_config = previous_config;
+}
+
+static void a_copy_benchmark_fn(test_run_data& bugspray_data)
+{
+    BUGSPRAY_BENCHMARK("copy")
+    {
+        return 1;
+    };
+}
+
+static void a_copy_benchmark_in_section_fn(test_run_data& bugspray_data)
+{
+    BUGSPRAY_SECTION("section")
+    {
+        BUGSPRAY_BENCHMARK("copy")
+        {
+            return 2;
+        };
+    }
+}
+
+TEST_CASE("benchmark baselines are keyed by test case and section", "[benchmark]")
+{
+    constexpr test_case first{
+        .name            = "first",
+        .tags            = {},
+        .source_location = {"some_file.cpp", 42},
+        .test_fn         = &a_copy_benchmark_fn,
+    };
+    constexpr test_case second{
+        .name            = "second",
+        .tags            = {},
+        .source_location = {"some_file.cpp", 43},
+        .test_fn         = &a_copy_benchmark_in_section_fn,
+    };
+    auto const run = [](test_case const& tc)
+    {
+        caching_reporter the_reporter;
+        return evaluate_test_case(tc, the_reporter);
+    };
+
+    auto const previous_config = g_benchmark_config;
+    g_benchmark_config         = benchmark_config{
+                .samples     = 3,
+                .resamples   = 10,
+                .warmup_time = std::chrono::milliseconds{0},
+    };
+
+    std::vector<std::string> const sections{"section"};
+
+    SECTION("recorded separately")
+    {
+        benchmark_baseline recording;
+        g_benchmark_config.recording = &recording;
+
+        REQUIRE(run(first));
+        REQUIRE(run(second));
+        REQUIRE(recording.entries().size() == 2);
+        REQUIRE(recording.find("first", {}, "copy") != nullptr);
+        REQUIRE(recording.find("second", sections, "copy") != nullptr);
+        REQUIRE(recording.find("second", {}, "copy") == nullptr);
+
+        std::stringstream stream;
+        recording.write(stream);
+        auto const read = benchmark_baseline::read(stream);
+        REQUIRE(read.has_value());
+        REQUIRE(read->entries().size() == 2);
+        REQUIRE(read->find("first", {}, "copy") != nullptr);
+        REQUIRE(read->find("second", sections, "copy") != nullptr);
+    }
+    SECTION("compared to their own baseline")
+    {
+        benchmark_baseline baseline;
+        baseline.record({.test_case = "first",
+                         .sections  = {},
+                         .name      = "copy",
+                         .mean      = 1e-6,
+                         .samples   = {1e-6, 1e-6, 1e-6}});
+        baseline.record({.test_case = "second",
+                         .sections  = sections,
+                         .name      = "copy",
+                         .mean      = 1e9,
+                         .samples   = {1e9, 1e9, 1e9}});
+        g_benchmark_config.baseline = &baseline;
+
+        REQUIRE_FALSE(run(first));
+        REQUIRE(run(second));
+    }
+
+    g_benchmark_config = previous_config;
+}
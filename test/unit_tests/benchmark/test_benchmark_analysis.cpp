@@ -0,0 +1,117 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "bugspray/benchmark/benchmark_analysis.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <array>
+
+using namespace bs;
+
+TEST_CASE("classify_outliers", "[benchmark]")
+{
+    constexpr std::array samples = {10., 11., 12., 10., 11., 12., 10., 11., 12., 11., 16., 30., -2.};
+
+    auto const o = classify_outliers(samples);
+    REQUIRE(o.samples_seen == samples.size());
+    REQUIRE(o.low_severe == 1);
+    REQUIRE(o.low_mild == 0);
+    REQUIRE(o.high_mild == 1);
+    REQUIRE(o.high_severe == 1);
+    REQUIRE(o.total() == 3);
+}
+
+TEST_CASE("analyse_samples", "[benchmark]")
+{
+    SECTION("uniform samples")
+    {
+        constexpr std::array samples = {5., 5., 5., 5., 5.};
+
+        auto const a = analyse_samples(samples, 1000, 0.95, 0);
+        REQUIRE(a.mean.point == 5.);
+        REQUIRE(a.mean.lower_bound == 5.);
+        REQUIRE(a.mean.upper_bound == 5.);
+        REQUIRE(a.mean.confidence_interval == 0.95);
+        REQUIRE(a.standard_deviation.point == 0.);
+        REQUIRE(a.outliers.total() == 0);
+        REQUIRE(a.outlier_variance == 0.);
+    }
+    SECTION("varying samples")
+    {
+        constexpr std::array samples = {9., 10., 11., 10., 9., 11., 10., 12., 8., 10.};
+
+        auto const a = analyse_samples(samples, 1000, 0.95, 0);
+        REQUIRE(a.mean.point == 10.);
+        REQUIRE(a.mean.lower_bound <= a.mean.point);
+        REQUIRE(a.mean.upper_bound >= a.mean.point);
+        REQUIRE(a.mean.lower_bound < a.mean.upper_bound);
+        REQUIRE(a.standard_deviation.point > 0.);
+        REQUIRE(a.standard_deviation.lower_bound <= a.standard_deviation.point);
+        REQUIRE(a.standard_deviation.upper_bound >= a.standard_deviation.point);
+    }
+    SECTION("no resamples")
+    {
+        constexpr std::array samples = {1., 2., 3.};
+
+        auto const a = analyse_samples(samples, 0, 0.95, 0);
+        REQUIRE(a.mean.point == 2.);
+        REQUIRE(a.mean.lower_bound == 2.);
+        REQUIRE(a.mean.upper_bound == 2.);
+    }
+}
+
+TEST_CASE("mann_whitney_u", "[benchmark]")
+{
+    constexpr std::array slow = {20., 21., 22., 23., 24., 25., 26., 27.};
+    constexpr std::array fast = {10., 11., 12., 13., 14., 15., 16., 17.};
+
+    SECTION("slower")
+    {
+        auto const r = mann_whitney_u(fast, slow);
+        REQUIRE(r.u == 64.);
+        REQUIRE(r.p_value < 0.001);
+    }
+    SECTION("faster")
+    {
+        auto const r = mann_whitney_u(slow, fast);
+        REQUIRE(r.u == 0.);
+        REQUIRE(r.p_value > 0.999);
+    }
+    SECTION("identical")
+    {
+        auto const r = mann_whitney_u(fast, fast);
+        REQUIRE(r.u == 32.);
+        REQUIRE(r.p_value > 0.5);
+    }
+    SECTION("all tied")
+    {
+        constexpr std::array same = {5., 5., 5.};
+
+        REQUIRE(mann_whitney_u(same, same).p_value == 1.);
+    }
+    SECTION("empty")
+    {
+        REQUIRE(mann_whitney_u({}, slow).p_value == 1.);
+    }
+}
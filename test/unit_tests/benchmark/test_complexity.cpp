@@ -0,0 +1,157 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#define BUGSPRAY_NO_SHORT_MACROS
+#include "bugspray/benchmark/complexity.hpp"
+#include "bugspray/macro_interface/assertion_macros.hpp"
+#include "bugspray/macro_interface/complexity_macros.hpp"
+#include "bugspray/reporter/caching_reporter.hpp"
+#include "bugspray/test_evaluation/evaluate_test_case.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <array>
+
+using namespace bs;
+
+TEST_CASE("fit_complexity", "[benchmark]")
+{
+    constexpr auto fit = [](auto cost, complexity_errors errors = complexity_errors::absolute)
+    {
+        std::array<std::size_t, 8> sizes{};
+        std::array<double, 8>      costs{};
+        for (std::size_t i = 0; i < sizes.size(); ++i)
+        {
+            sizes[i] = std::size_t{16} << i;
+            costs[i] = cost(static_cast<double>(sizes[i]), static_cast<double>(4 + i));
+        }
+        return fit_complexity(sizes, costs, errors);
+    };
+    constexpr auto relative = complexity_errors::relative;
+
+#define MAKE_TESTS(PREFIX)                                                                                             \
+    PREFIX##REQUIRE(fit([](double, double) { return 7.; }) == complexity::constant);                                   \
+    PREFIX##REQUIRE(fit([](double, double lg) { return 3. * lg; }) == complexity::logarithmic);                        \
+    PREFIX##REQUIRE(fit([](double n, double) { return 2. * n; }) == complexity::linear);                               \
+    PREFIX##REQUIRE(fit([](double n, double lg) { return n * lg; }) == complexity::linearithmic);                      \
+    PREFIX##REQUIRE(fit([](double n, double) { return n * n / 2.; }) == complexity::quadratic);                        \
+    PREFIX##REQUIRE(fit([](double n, double) { return n * n + 100. * n; }) == complexity::quadratic);                  \
+    PREFIX##REQUIRE(fit([](double, double) { return 0.; }) == complexity::constant);                                   \
+    PREFIX##REQUIRE(fit([](double n, double) { return 2. * n + 5.; }, relative) == complexity::linear);                \
+    PREFIX##REQUIRE(fit([](double n, double lg) { return n * lg; }, relative) == complexity::linearithmic);            \
+    PREFIX##REQUIRE(fit([](double n, double) { return n * n; }, relative) == complexity::quadratic);                   \
+    PREFIX##REQUIRE(fit([](double, double) { return 0.; }, relative) == complexity::constant);
+
+    MAKE_TESTS()
+    MAKE_TESTS(STATIC_)
+#undef MAKE_TESTS
+}
+
+TEST_CASE("measure_complexity", "[benchmark]")
+{
+    SECTION("counting operations")
+    {
+        constexpr auto linear = [](std::size_t n) { return n; };
+        STATIC_REQUIRE(measure_complexity(1024, linear) == complexity::linear);
+        REQUIRE(measure_complexity(1024, linear) == complexity::linear);
+        STATIC_REQUIRE_FALSE(measure_complexity(32, linear).has_value());
+        REQUIRE_FALSE(measure_complexity(32, linear).has_value());
+    }
+    SECTION("timing")
+    {
+        constexpr auto timed = [](std::size_t) {};
+        STATIC_REQUIRE_FALSE(measure_complexity(1024, timed).has_value());
+
+        auto const quadratic = [](std::size_t n)
+        {
+            std::size_t sum = 0;
+            for (std::size_t i = 0; i < n; ++i)
+                for (std::size_t j = 0; j < n; ++j)
+                {
+                    sum += i ^ j;
+                    keep_value(sum);
+                }
+        };
+        auto const fitted = measure_complexity(1024, quadratic);
+        REQUIRE(fitted.has_value());
+        REQUIRE(*fitted > complexity::linear);
+    }
+}
+
+static constexpr auto count_insertion_sort(std::size_t n) -> std::size_t
+{
+    // Comparisons of insertion sort on reversed input
+    return n * (n - 1) / 2;
+}
+
+static constexpr void a_complexity_test_case_fn(test_run_data& bugspray_data)
+{
+    BUGSPRAY_CHECK_COMPLEXITY(linear, 256, [](std::size_t n) { return 3 * n + 1; });
+    BUGSPRAY_CHECK_COMPLEXITY(linear, 256, count_insertion_sort);
+    BUGSPRAY_CHECK_COMPLEXITY(quadratic, 256, count_insertion_sort);
+    BUGSPRAY_CHECK_COMPLEXITY(constant, 32, [](std::size_t) { return 1; });
+    BUGSPRAY_REQUIRE_COMPLEXITY(constant, 256, [](std::size_t n) { return n; });
+    BUGSPRAY_SUCCEED(); // Not reached
+}
+
+TEST_CASE("CHECK_COMPLEXITY", "[benchmark]")
+{
+    constexpr auto test = [](auto fn)
+    {
+        constexpr test_case tc{
+            .name            = "foo",
+            .tags            = {},
+            .source_location = {"some_file.cpp", 42},
+            .test_fn         = &a_complexity_test_case_fn,
+        };
+        caching_reporter the_reporter;
+        bool const       success = evaluate_test_case(tc, the_reporter);
+        return fn(success, the_reporter.cache());
+    };
+    constexpr auto return_result = [](bool result, bs::vector<caching_reporter::test_case_data> const&)
+    {
+        return result;
+    };
+    constexpr auto return_assertions = [](bool, bs::vector<caching_reporter::test_case_data> const& cache)
+    {
+        return cache[0].test_runs[0].assertions;
+    };
+
+#define MAKE_TESTS(PREFIX)                                                                                             \
+    PREFIX##CHECK(test(return_result) == false);                                                                       \
+    PREFIX##REQUIRE(test(return_assertions).size() == 5);                                                              \
+    PREFIX##REQUIRE(test(return_assertions)[0].result);                                                                \
+    PREFIX##REQUIRE(test(return_assertions)[0].expansion == "O(n) <= O(n)");                                           \
+    PREFIX##REQUIRE_FALSE(test(return_assertions)[1].result);                                                          \
+    PREFIX##REQUIRE(test(return_assertions)[1].text == "CHECK_COMPLEXITY(linear, 256, count_insertion_sort)");         \
+    PREFIX##REQUIRE(test(return_assertions)[1].expansion == "O(n^2) <= O(n)");                                         \
+    PREFIX##REQUIRE(test(return_assertions)[2].result);                                                                \
+    PREFIX##REQUIRE_FALSE(test(return_assertions)[3].result);                                                          \
+    PREFIX##REQUIRE(test(return_assertions)[3].expansion == "not enough sizes: max size 32 < 64");                     \
+    PREFIX##REQUIRE_FALSE(test(return_assertions)[4].result);
+
+    MAKE_TESTS()
+    MAKE_TESTS(STATIC_)
+#undef MAKE_TESTS
+}
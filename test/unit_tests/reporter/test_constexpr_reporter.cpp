@@ -0,0 +1,89 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#define BUGSPRAY_NO_SHORT_MACROS
+#include "bugspray/macro_interface/assertion_macros.hpp"
+#include "bugspray/macro_interface/section_macro.hpp"
+#include "bugspray/macro_interface/test_case_macros.hpp"
+#include "bugspray/reporter/constexpr_reporter.hpp"
+#include "bugspray/test_evaluation/evaluate_test_case.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <string_view>
+
+using namespace bs;
+
+static constexpr void a_multiple_failures_test_case_fn(test_run_data& bugspray_data)
+{
+    BUGSPRAY_CHECK(1 == 2);
+    BUGSPRAY_SECTION("s1")
+    {
+        BUGSPRAY_CHECK(2 == 3);
+        BUGSPRAY_CHECK(3 == 3);
+    }
+    BUGSPRAY_SECTION("s2")
+    {
+        BUGSPRAY_CHECK(4 == 5);
+    }
+}
+
+TEST_CASE("constexpr_reporter", "[reporter]")
+{
+    static constexpr test_case tc{
+        .name            = "multiple failures",
+        .tags            = {},
+        .source_location = {"some_file.cpp", 42},
+        .test_fn         = &a_multiple_failures_test_case_fn,
+    };
+
+    SECTION("reports the first failure only by default")
+    {
+        static constexpr auto result = evaluate_test_case_constexpr<0>(tc);
+        STATIC_REQUIRE_FALSE(result.success);
+        STATIC_REQUIRE(result.failure_count == 1);
+        STATIC_REQUIRE(std::string_view{result.failures[0]}.find("1 == 2") != std::string_view::npos);
+    }
+
+    SECTION("collects failures across runs")
+    {
+        static constexpr auto result = evaluate_test_case_constexpr<0, 8>(tc);
+        STATIC_REQUIRE_FALSE(result.success);
+        STATIC_REQUIRE(result.failure_count == 4);
+        STATIC_REQUIRE(std::string_view{result.failures[0]}.find("1 == 2") != std::string_view::npos);
+        STATIC_REQUIRE(std::string_view{result.failures[1]}.find("2 == 3") != std::string_view::npos);
+        STATIC_REQUIRE(std::string_view{result.failures[1]}.find("IN: some_file.cpp:42: multiple failures")
+                       != std::string_view::npos);
+        STATIC_REQUIRE(std::string_view{result.failures[2]}.find("1 == 2") != std::string_view::npos);
+        STATIC_REQUIRE(std::string_view{result.failures[3]}.find("4 == 5") != std::string_view::npos);
+    }
+
+    SECTION("stops collecting at the limit")
+    {
+        static constexpr auto result = evaluate_test_case_constexpr<0, 2>(tc);
+        STATIC_REQUIRE_FALSE(result.success);
+        STATIC_REQUIRE(result.failure_count == 2);
+        STATIC_REQUIRE(std::string_view{result.failures[1]}.find("2 == 3") != std::string_view::npos);
+    }
+}
@@ -0,0 +1,105 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "bugspray/reporter/caching_reporter.hpp"
+#include "bugspray/reporter/constexpr_reporter.hpp"
+#include "bugspray/reporter/multi_reporter.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <array>
+
+using namespace bs;
+
+TEST_CASE("multi_reporter", "[reporter]")
+{
+    constexpr std::string_view filename = "some_file.cpp";
+
+    constexpr std::string_view test_case_name = "test_case";
+    constexpr std::string_view section_name   = "section";
+    constexpr std::string_view assertion      = "CHECK(false)";
+
+    constexpr auto test = [filename, test_case_name, section_name, assertion]()
+    {
+        caching_reporter first;
+        caching_reporter second;
+
+        multi_reporter reporter;
+        reporter.add(first);
+        reporter.add(second);
+
+        reporter.enter_test_case(test_case_name, {}, source_location{.file_name = filename, .line = 10});
+        reporter.start_run();
+        reporter.enter_section(section_name, source_location{.file_name = filename, .line = 20});
+        reporter.log_assertion(assertion, source_location{.file_name = filename, .line = 30}, {}, {}, false);
+        reporter.log_metric("metric", 1., "unit");
+        reporter.leave_section();
+        reporter.log_target(section_path{bs::string{section_name}});
+        reporter.stop_run();
+        reporter.leave_test_case();
+        reporter.finalize();
+
+        return std::array{first.cache(), second.cache()};
+    };
+
+#define MAKE_TESTS(PREFIX)                                                                                             \
+    PREFIX##REQUIRE(test()[0].size() == 1);                                                                            \
+    PREFIX##REQUIRE(test()[1].size() == 1);                                                                            \
+    PREFIX##REQUIRE(test()[0][0].name == test_case_name);                                                              \
+    PREFIX##REQUIRE(test()[1][0].name == test_case_name);                                                              \
+    PREFIX##REQUIRE(test()[0][0].test_runs.size() == 1);                                                               \
+    PREFIX##REQUIRE(test()[1][0].test_runs.size() == 1);                                                               \
+    PREFIX##REQUIRE(test()[0][0].test_runs[0].target == section_path{bs::string{section_name}});                       \
+    PREFIX##REQUIRE(test()[1][0].test_runs[0].target == section_path{bs::string{section_name}});                       \
+    PREFIX##REQUIRE(test()[0][0].test_runs[0].sections.size() == 1);                                                   \
+    PREFIX##REQUIRE(test()[1][0].test_runs[0].sections.size() == 1);                                                   \
+    PREFIX##REQUIRE(test()[0][0].test_runs[0].sections[0].assertions.size() == 1);                                     \
+    PREFIX##REQUIRE(test()[1][0].test_runs[0].sections[0].assertions.size() == 1);                                     \
+    PREFIX##REQUIRE(test()[0][0].test_runs[0].sections[0].assertions[0].text == assertion);                            \
+    PREFIX##REQUIRE(test()[1][0].test_runs[0].sections[0].assertions[0].text == assertion);                            \
+    PREFIX##REQUIRE(test()[0][0].test_runs[0].sections[0].metrics.size() == 1);                                        \
+    PREFIX##REQUIRE(test()[1][0].test_runs[0].sections[0].metrics.size() == 1);
+
+    MAKE_TESTS(STATIC_)
+    MAKE_TESTS()
+
+#undef MAKE_TESTS
+}
+
+TEST_CASE("multi_reporter needs passed assertions if any of its reporters does", "[reporter]")
+{
+    constexpr auto test = [](bool add_caching_reporter)
+    {
+        constexpr_reporter first;
+        caching_reporter   second;
+
+        multi_reporter reporter;
+        reporter.add(first);
+        if (add_caching_reporter)
+            reporter.add(second);
+        return reporter.needs_passed_assertions();
+    };
+
+    STATIC_REQUIRE(!test(false));
+    STATIC_REQUIRE(test(true));
+}
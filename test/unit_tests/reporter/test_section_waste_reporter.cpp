@@ -0,0 +1,84 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#define BUGSPRAY_NO_SHORT_MACROS
+#include "bugspray/macro_interface/section_macro.hpp"
+#include "bugspray/reporter/section_waste_reporter.hpp"
+#include "bugspray/test_evaluation/evaluate_test_case.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace bs;
+
+namespace
+{
+// Both runs execute the slow prefix, but only one execution of it is necessary
+void a_test_case_fn(test_run_data& bugspray_data)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds{5});
+    BUGSPRAY_SECTION("first")
+    {
+    }
+    BUGSPRAY_SECTION("second")
+    {
+    }
+}
+} // namespace
+
+TEST_CASE("section_waste_reporter", "[reporter]")
+{
+    constexpr test_case tc{
+        .name            = "slow_prefix",
+        .tags            = {},
+        .source_location = {"some_file.cpp", 42},
+        .test_fn         = &a_test_case_fn,
+    };
+
+    std::ostringstream     stream;
+    section_waste_reporter reporter{stream};
+    REQUIRE(evaluate_test_case(tc, reporter));
+    reporter.finalize();
+
+    auto const output = stream.str();
+    CAPTURE(output);
+    auto const row = output.find("\nslow_prefix");
+    REQUIRE(row != std::string::npos);
+
+    std::istringstream columns{output.substr(row)};
+    std::string        name;
+    std::size_t        leaves  = 0;
+    std::size_t        runs    = 0;
+    double             runtime = 0;
+    double             waste   = 0;
+    REQUIRE(columns >> name >> leaves >> runs >> runtime >> waste);
+    CHECK(leaves == 2);
+    CHECK(runs == 2);
+    // The prefix is executed twice, so about half of the runtime is waste
+    CHECK(waste >= 4.);
+    CHECK(waste < runtime);
+}
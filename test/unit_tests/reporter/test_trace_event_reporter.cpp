@@ -0,0 +1,215 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#define BUGSPRAY_NO_SHORT_MACROS
+#include "bugspray/macro_interface/assertion_macros.hpp"
+#include "bugspray/macro_interface/section_macro.hpp"
+#include "bugspray/reporter/trace_event_reporter.hpp"
+#include "bugspray/test_evaluation/evaluate_test_case.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <cctype>
+
+using namespace bs;
+
+namespace
+{
+void a_test_case_fn(test_run_data& bugspray_data)
+{
+    int const one = 1;
+    BUGSPRAY_CHECK(one == 1);
+    BUGSPRAY_SECTION("first")
+    {
+        BUGSPRAY_CHECK(one == 1);
+        BUGSPRAY_CHECK(one == 2);
+    }
+    BUGSPRAY_SECTION("second")
+    {
+        BUGSPRAY_CHECK(one == 1);
+    }
+}
+
+// A minimal JSON validator, which consumes one value from the front of str
+auto consume_json_value(std::string_view& str) -> bool;
+
+void skip_whitespace(std::string_view& str)
+{
+    while (!str.empty() && std::isspace(static_cast<unsigned char>(str.front())))
+        str.remove_prefix(1);
+}
+
+auto consume(std::string_view& str, char c) -> bool
+{
+    skip_whitespace(str);
+    if (str.empty() || str.front() != c)
+        return false;
+    str.remove_prefix(1);
+    return true;
+}
+
+auto consume_json_string(std::string_view& str) -> bool
+{
+    if (!consume(str, '"'))
+        return false;
+    while (!str.empty() && str.front() != '"')
+    {
+        if (static_cast<unsigned char>(str.front()) < 0x20)
+            return false;
+        if (str.front() == '\\')
+            str.remove_prefix(1);
+        if (!str.empty())
+            str.remove_prefix(1);
+    }
+    return consume(str, '"');
+}
+
+template<char Open, char Close>
+auto consume_json_sequence(std::string_view& str, bool with_keys) -> bool
+{
+    if (!consume(str, Open))
+        return false;
+    if (consume(str, Close))
+        return true;
+    do
+    {
+        if (with_keys && !(consume_json_string(str) && consume(str, ':')))
+            return false;
+        if (!consume_json_value(str))
+            return false;
+    } while (consume(str, ','));
+    return consume(str, Close);
+}
+
+auto consume_json_value(std::string_view& str) -> bool
+{
+    skip_whitespace(str);
+    if (str.empty())
+        return false;
+    switch (str.front())
+    {
+    case '{': return consume_json_sequence<'{', '}'>(str, true);
+    case '[': return consume_json_sequence<'[', ']'>(str, false);
+    case '"': return consume_json_string(str);
+    default: break;
+    }
+    for (std::string_view const literal : {"true", "false", "null"})
+    {
+        if (str.starts_with(literal))
+        {
+            str.remove_prefix(literal.size());
+            return true;
+        }
+    }
+    auto const length = str.find_first_not_of("+-.0123456789eE");
+    if (length == 0)
+        return false;
+    str.remove_prefix(length == std::string_view::npos ? str.size() : length);
+    return true;
+}
+
+auto is_valid_json(std::string_view str) -> bool
+{
+    bool const valid = consume_json_value(str);
+    skip_whitespace(str);
+    return valid && str.empty();
+}
+
+auto split_lines(std::string_view str) -> std::vector<std::string_view>
+{
+    std::vector<std::string_view> lines;
+    for (auto end = str.find('\n'); end != std::string_view::npos; end = str.find('\n'))
+    {
+        lines.push_back(str.substr(0, end));
+        str.remove_prefix(end + 1);
+    }
+    lines.push_back(str);
+    return lines;
+}
+
+// The value of a string field of an event, which the reporter writes on a line of its own
+auto field(std::string_view event, std::string_view name) -> std::string_view
+{
+    auto const key   = std::string{"\""} + std::string{name} + "\":\"";
+    auto const begin = event.find(key);
+    if (begin == std::string_view::npos)
+        return {};
+    event.remove_prefix(begin + key.size());
+    return event.substr(0, event.find('"'));
+}
+} // namespace
+
+TEST_CASE("trace_event_reporter", "[reporter]")
+{
+    constexpr test_case tc{
+        .name            = "foo",
+        .tags            = {},
+        .source_location = {"some_file.cpp", 42},
+        .test_fn         = &a_test_case_fn,
+    };
+
+    std::ostringstream stream;
+    {
+        trace_event_reporter reporter{stream};
+        REQUIRE_FALSE(evaluate_test_case(tc, reporter));
+        reporter.finalize();
+    }
+    std::string const output = stream.str();
+    CAPTURE(output);
+    REQUIRE(is_valid_json(output));
+
+    std::vector<std::string_view> open_events;
+    std::vector<std::string_view> counters;
+    std::vector<std::string_view> failures;
+    for (auto const event : split_lines(output))
+    {
+        if (!event.starts_with('{') || event.starts_with(R"({"displayTimeUnit")"))
+            continue;
+        auto const phase    = field(event, "ph");
+        auto const category = field(event, "cat");
+        if (phase == "B")
+            open_events.push_back(category);
+        else if (phase == "E")
+        {
+            REQUIRE_FALSE(open_events.empty());
+            CHECK(open_events.back() == category);
+            open_events.pop_back();
+        }
+        else if (phase == "C")
+            counters.push_back(event.substr(event.find(R"("args")")));
+        else if (phase == "i")
+            failures.push_back(field(event, "expression"));
+    }
+    CHECK(open_events.empty());
+
+    REQUIRE(counters.size() == 2);
+    CHECK(counters[0].starts_with(R"("args":{"passed":2,"failed":1}})"));
+    CHECK(counters[1].starts_with(R"("args":{"passed":2,"failed":0}})"));
+    REQUIRE(failures.size() == 1);
+    CHECK(failures[0] == "CHECK(one == 2)");
+}
@@ -0,0 +1,55 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#define BUGSPRAY_NO_SHORT_MACROS
+#define BUGSPRAY_COMPILE_EVAL_TEST_SPEC "exclude:excluded"
+#include "bugspray/macro_interface/assertion_macros.hpp"
+#include "bugspray/macro_interface/test_case_macros.hpp"
+
+#include <catch2/catch_all.hpp>
+
+using namespace bs;
+
+static constexpr void a_selected_test_case_fn(test_run_data& bugspray_data)
+{
+    BUGSPRAY_REQUIRE(true);
+}
+BUGSPRAY_REGISTER_TEST_CASE(&a_selected_test_case_fn, "selected", "", compiletime);
+
+// Would not compile if it was evaluated at compile time
+static constexpr void a_failing_test_case_fn(test_run_data& bugspray_data)
+{
+    BUGSPRAY_REQUIRE(false);
+}
+BUGSPRAY_REGISTER_TEST_CASE(&a_failing_test_case_fn, "excluded", "", compiletime);
+
+TEST_CASE("BUGSPRAY_COMPILE_EVAL_TEST_SPEC", "[test_evaluation]")
+{
+    STATIC_REQUIRE(evaluate_compiletime_test<"selected", 0>::selected);
+    STATIC_REQUIRE(BUGSPRAY_EVAL_TEST_CASE_STATS("selected").assertions == 1);
+
+    // Tests excluded by the spec are not evaluated at all
+    STATIC_REQUIRE_FALSE(evaluate_compiletime_test<"excluded", 0>::selected);
+    STATIC_REQUIRE(evaluate_compiletime_test<"excluded", 0>{}());
+    STATIC_REQUIRE(BUGSPRAY_EVAL_TEST_CASE_STATS("excluded") == evaluation_stats{});
+}
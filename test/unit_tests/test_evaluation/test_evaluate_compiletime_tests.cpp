@@ -0,0 +1,107 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#define BUGSPRAY_NO_SHORT_MACROS
+#include "bugspray/macro_interface/assertion_macros.hpp"
+#include "bugspray/macro_interface/section_macro.hpp"
+#include "bugspray/macro_interface/test_case_macros.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <string_view>
+
+using namespace bs;
+
+static constexpr void a_passing_test_case_fn(test_run_data& bugspray_data)
+{
+    BUGSPRAY_REQUIRE(true);
+    BUGSPRAY_SECTION("s1")
+    {
+        BUGSPRAY_CHECK(true);
+    }
+}
+BUGSPRAY_REGISTER_TEST_CASE(&a_passing_test_case_fn, "eval_all_passing", "", compiletime);
+
+static constexpr void a_failing_test_case_fn(test_run_data& bugspray_data)
+{
+    BUGSPRAY_CHECK(1 == 2);
+}
+BUGSPRAY_REGISTER_TEST_CASE(&a_failing_test_case_fn, "eval_all_failing", "", compiletime);
+BUGSPRAY_REGISTER_TEST_CASE(&a_failing_test_case_fn, "eval_all_failing_again", "", compiletime);
+
+// Many registrations, to evaluate in more than one chunk
+#define REGISTER_PASSING()                                                                                             \
+    BUGSPRAY_REGISTER_TEST_CASE(&a_passing_test_case_fn,                                                               \
+                                "eval_all_many_" BUGSPRAY_STRINGIFY_EXPANSION(__COUNTER__),                            \
+                                "",                                                                                    \
+                                compiletime)
+#define REGISTER_PASSING_8()                                                                                           \
+    REGISTER_PASSING();                                                                                                \
+    REGISTER_PASSING();                                                                                                \
+    REGISTER_PASSING();                                                                                                \
+    REGISTER_PASSING();                                                                                                \
+    REGISTER_PASSING();                                                                                                \
+    REGISTER_PASSING();                                                                                                \
+    REGISTER_PASSING();                                                                                                \
+    REGISTER_PASSING();
+REGISTER_PASSING_8()
+REGISTER_PASSING_8()
+REGISTER_PASSING_8()
+REGISTER_PASSING_8()
+REGISTER_PASSING_8()
+REGISTER_PASSING_8()
+REGISTER_PASSING_8()
+REGISTER_PASSING_8()
+REGISTER_PASSING_8()
+#undef REGISTER_PASSING_8
+#undef REGISTER_PASSING
+
+using tu = detail::translation_unit_tag;
+
+static constexpr int test_case_count = detail::compiletime_test_count<tu, __COUNTER__>();
+
+TEST_CASE("evaluate_compiletime_tests", "[test_evaluation]")
+{
+    // Test cases are numbered densely, independent of other uses of __COUNTER__
+    STATIC_REQUIRE(test_case_count == 3 + 72);
+    STATIC_REQUIRE(detail::compiletime_test_entry<tu, 0>::value->name == "eval_all_passing");
+    STATIC_REQUIRE(detail::compiletime_test_entry<tu, 2>::value->name == "eval_all_failing_again");
+    STATIC_REQUIRE(detail::compiletime_test_entry<tu, 74>::value->name.starts_with("eval_all_many_"));
+
+    static constexpr auto all = evaluate_compiletime_tests_constexpr<tu, test_case_count, "">();
+    STATIC_REQUIRE_FALSE(all.success);
+
+    // The failures of all test cases are aggregated
+    STATIC_REQUIRE(all.failure_count == 2);
+    STATIC_REQUIRE(all.failures.size() == 2);
+    STATIC_REQUIRE(std::string_view{all.failures[0]}.find("eval_all_failing") != std::string_view::npos);
+    STATIC_REQUIRE(std::string_view{all.failures[1]}.find("eval_all_failing_again") != std::string_view::npos);
+
+    static constexpr auto passing
+        = evaluate_compiletime_tests_constexpr<tu, test_case_count, "exclude:eval_all_failing*">();
+    STATIC_REQUIRE(passing.success);
+    STATIC_REQUIRE(passing.failure_count == 0);
+    STATIC_REQUIRE(passing.failures.size() == 0);
+
+    STATIC_REQUIRE(evaluate_compiletime_tests<tu, test_case_count, "eval_all_passing">());
+}
@@ -0,0 +1,99 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#define BUGSPRAY_NO_SHORT_MACROS
+#include "bugspray/macro_interface/assertion_macros.hpp"
+#include "bugspray/macro_interface/metric_macros.hpp"
+#include "bugspray/macro_interface/section_macro.hpp"
+#include "bugspray/reporter/caching_reporter.hpp"
+#include "bugspray/test_evaluation/evaluate_test_case.hpp"
+
+#include <catch2/catch_all.hpp>
+
+using namespace bs;
+
+static auto runtime_only_value() -> double
+{
+    return 120.;
+}
+
+static constexpr void a_metric_test_case_fn(test_run_data& bugspray_data)
+{
+    BUGSPRAY_REPORT_METRIC("throughput", runtime_only_value(), "MB/s");
+    BUGSPRAY_SECTION("section")
+    {
+        BUGSPRAY_REPORT_METRIC("latency", 2.5, "ms", <= 2.);
+        BUGSPRAY_REPORT_METRIC("operations", 1000, "ops/s", >= 100);
+    }
+}
+
+TEST_CASE("evaluate_test_case (metrics)", "[test_evaluation]")
+{
+    constexpr auto test = [](auto fn)
+    {
+        constexpr test_case tc{
+            .name            = "foo",
+            .tags            = {},
+            .source_location = {"some_file.cpp", 42},
+            .test_fn         = &a_metric_test_case_fn,
+        };
+        caching_reporter the_reporter;
+        bool const       success = evaluate_test_case(tc, the_reporter);
+        return fn(success, the_reporter.cache());
+    };
+    constexpr auto return_result = [](bool result, bs::vector<caching_reporter::test_case_data> const&)
+    {
+        return result;
+    };
+    constexpr auto return_run = [](bool, bs::vector<caching_reporter::test_case_data> const& cache)
+    {
+        return cache[0].test_runs[0];
+    };
+
+    // Metrics are neither evaluated nor reported during constant evaluation
+    STATIC_REQUIRE(test(return_result));
+    STATIC_REQUIRE(test(return_run).metrics.size() == 0);
+    STATIC_REQUIRE(test(return_run).sections[0].metrics.size() == 0);
+    STATIC_REQUIRE(test(return_run).sections[0].assertions.size() == 0);
+
+    REQUIRE_FALSE(test(return_result));
+
+    auto const run = test(return_run);
+    REQUIRE(run.metrics.size() == 1);
+    REQUIRE(run.metrics[0].name == "throughput");
+    REQUIRE(run.metrics[0].value == 120.);
+    REQUIRE(run.metrics[0].unit == "MB/s");
+    REQUIRE(run.assertions.size() == 0);
+
+    auto const& section = run.sections[0];
+    REQUIRE(section.metrics.size() == 2);
+    REQUIRE(section.metrics[0].name == "latency");
+    REQUIRE(section.metrics[0].value == 2.5);
+    REQUIRE(section.metrics[1].name == "operations");
+    REQUIRE(section.metrics[1].value == 1000.);
+    REQUIRE(section.assertions.size() == 2);
+    REQUIRE(section.assertions[0].text == R"(REPORT_METRIC("latency", 2.5, "ms", <= 2.))");
+    REQUIRE_FALSE(section.assertions[0].result);
+    REQUIRE(section.assertions[1].result);
+}
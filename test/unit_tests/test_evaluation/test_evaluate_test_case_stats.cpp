@@ -0,0 +1,86 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#define BUGSPRAY_NO_SHORT_MACROS
+#include "bugspray/macro_interface/assertion_macros.hpp"
+#include "bugspray/macro_interface/capture_macro.hpp"
+#include "bugspray/macro_interface/section_macro.hpp"
+#include "bugspray/macro_interface/test_case_macros.hpp"
+#include "bugspray/reporter/noop_reporter.hpp"
+#include "bugspray/test_evaluation/evaluate_test_case.hpp"
+
+#include <catch2/catch_all.hpp>
+
+using namespace bs;
+
+static constexpr void a_stats_test_case_fn(test_run_data& bugspray_data)
+{
+    int const i = 42;
+    BUGSPRAY_CAPTURE(i);
+    BUGSPRAY_REQUIRE(i == 42);
+    BUGSPRAY_SECTION("s1")
+    {
+        BUGSPRAY_SECTION("s11")
+        {
+            BUGSPRAY_CHECK(i > 0);
+        }
+        BUGSPRAY_SECTION("s12")
+        {
+            int const j = 43;
+            BUGSPRAY_CAPTURE(j);
+            BUGSPRAY_CHECK(i < j);
+            BUGSPRAY_CHECK(j > 0);
+        }
+    }
+    BUGSPRAY_SECTION("s2") {}
+}
+BUGSPRAY_REGISTER_TEST_CASE(&a_stats_test_case_fn, "evaluation stats", "", compiletime);
+
+TEST_CASE("evaluate_test_case (stats)", "[test_evaluation]")
+{
+    constexpr auto stats = []
+    {
+        constexpr test_case tc{
+            .name            = "foo",
+            .tags            = {},
+            .source_location = {"some_file.cpp", 42},
+            .test_fn         = &a_stats_test_case_fn,
+        };
+        noop_reporter    the_reporter;
+        evaluation_stats result;
+        evaluate_test_case(tc, the_reporter, "", &result);
+        return result;
+    };
+    constexpr evaluation_stats expected{
+        .runs       = 3,
+        .sections   = 5,
+        .assertions = 6,
+        .captures   = 4,
+    };
+
+    STATIC_REQUIRE(stats() == expected);
+    REQUIRE(stats() == expected);
+
+    STATIC_REQUIRE(BUGSPRAY_EVAL_TEST_CASE_STATS("evaluation stats") == expected);
+    STATIC_REQUIRE(BUGSPRAY_EVAL_TEST_CASE_STATS("evaluation stats").assertions < 10);
+}
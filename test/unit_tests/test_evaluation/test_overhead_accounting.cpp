@@ -0,0 +1,84 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#define BUGSPRAY_NO_SHORT_MACROS
+#include "bugspray/macro_interface/assertion_macros.hpp"
+#include "bugspray/reporter/caching_reporter.hpp"
+#include "bugspray/test_evaluation/evaluate_test_case.hpp"
+#include "bugspray/test_evaluation/overhead_accounting.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <chrono>
+#include <utility>
+
+using namespace bs;
+
+namespace
+{
+struct slow_to_print
+{
+    int value;
+
+    auto operator==(slow_to_print const&) const -> bool = default;
+};
+
+auto to_string(slow_to_print const& s) -> bs::string
+{
+    auto const end = std::chrono::steady_clock::now() + std::chrono::milliseconds{5};
+    while (std::chrono::steady_clock::now() < end)
+    {
+    }
+    return bs::to_string(s.value);
+}
+
+void a_slow_to_print_test_case_fn(test_run_data& bugspray_data)
+{
+    BUGSPRAY_CHECK(slow_to_print{1} == slow_to_print{2});
+}
+} // namespace
+
+TEST_CASE("overhead accounting charges stringification to assertions", "[test_evaluation]")
+{
+    test_case const tc{
+        .name            = "foo",
+        .tags            = {},
+        .source_location = {"some_file.cpp", 42},
+        .test_fn         = &a_slow_to_print_test_case_fn,
+    };
+
+    overhead_accountant accountant;
+    auto* const         previous = std::exchange(g_overhead_accountant, &accountant);
+    caching_reporter    the_reporter;
+    bool const          success = evaluate_test_case(tc, the_reporter);
+    g_overhead_accountant       = previous;
+
+    REQUIRE_FALSE(success);
+    REQUIRE(the_reporter.cache()[0].test_runs[0].assertions[0].expansion == "1 == 2");
+
+    auto const& totals     = accountant.totals();
+    auto const  assertions = totals[static_cast<std::size_t>(overhead_category::assertions)];
+    auto const  test_code  = totals[static_cast<std::size_t>(overhead_category::test_code)];
+    CHECK(assertions >= std::chrono::milliseconds{10});
+    CHECK(test_code < assertions);
+}
@@ -22,11 +22,16 @@
 // SOFTWARE.
 //
 #include "bugspray/reporter/caching_reporter.hpp"
+#include "bugspray/reporter/constexpr_reporter.hpp"
+#include "bugspray/test_evaluation/decomposition/decomposer.hpp"
+#include "bugspray/test_evaluation/evaluation_stats.hpp"
 #include "bugspray/test_evaluation/test_case_topology.hpp"
 #include "bugspray/test_evaluation/test_run_data.hpp"
 
 #include <catch2/catch_all.hpp>
 
+#include <string_view>
+
 using namespace bs;
 
 TEST_CASE("test_run_data", "[test_evaluation]")
@@ -70,4 +75,77 @@ TEST_CASE("test_run_data", "[test_evaluation]")
 
     STATIC_REQUIRE(test());
     REQUIRE(test());
-}
\ No newline at end of file
+}
+
+TEST_CASE("test_run_data::report_assertion", "[test_evaluation]")
+{
+    constexpr auto test = [](bool abort)
+    {
+        caching_reporter reporter;
+        reporter.enter_test_case("", {}, source_location{});
+        reporter.start_run();
+
+        test_case_topology topo;
+        test_run_data      data{reporter, topo};
+
+        data.report_assertion("test", source_location{}, "1 == 2", false, abort);
+
+        auto const& assertions = reporter.cache().front().test_runs.front().assertions;
+        return !data.success() && data.aborted() == abort && assertions.size() == 1 && !assertions.front().result &&
+               assertions.front().expansion == "1 == 2";
+    };
+
+    STATIC_REQUIRE(test(false));
+    STATIC_REQUIRE(test(true));
+    REQUIRE(test(false));
+    REQUIRE(test(true));
+}
+
+TEST_CASE("test_run_data::check_assertion", "[test_evaluation]")
+{
+    constexpr auto count_passes = []()
+    {
+        constexpr_reporter reporter;
+        reporter.enter_test_case("", {}, source_location{});
+        reporter.start_run();
+
+        test_case_topology topo;
+        evaluation_stats   stats;
+        test_run_data      data{reporter, topo, &stats};
+
+        int const  one     = 1;
+        bool const passed  = data.check_assertion("CHECK(one == 1)", source_location{}, decomposer{} % one == 1, false);
+        bool const counted = !data.logs_passed_assertions() && stats.assertions == 0;
+        data.count_passed_assertion();
+
+        data.enter_section("foo", source_location{});
+        bool const flushed = stats.assertions == 2;
+
+        bool const failed = !data.check_assertion("CHECK(one == 2)", source_location{}, decomposer{} % one == 2, false);
+        return passed && counted && flushed && failed && !data.success() && stats.assertions == 3 &&
+               reporter.failures().size() == 1 &&
+               std::string_view{reporter.failures().front()}.find("1 == 2") != std::string_view::npos;
+    };
+
+    constexpr auto log_passes = []()
+    {
+        caching_reporter reporter;
+        reporter.enter_test_case("", {}, source_location{});
+        reporter.start_run();
+
+        test_case_topology topo;
+        test_run_data      data{reporter, topo};
+
+        int const  one    = 1;
+        bool const passed = data.check_assertion("CHECK(one == 1)", source_location{}, decomposer{} % one == 1, true);
+
+        auto const& assertions = reporter.cache().front().test_runs.front().assertions;
+        return passed && data.logs_passed_assertions() && assertions.size() == 1 && assertions.front().result &&
+               assertions.front().expansion == "1 == 1";
+    };
+
+    STATIC_REQUIRE(count_passes());
+    STATIC_REQUIRE(log_passes());
+    REQUIRE(count_passes());
+    REQUIRE(log_passes());
+}
@@ -25,6 +25,8 @@
 
 #include <catch2/catch_all.hpp>
 
+#include <array>
+
 TEST_CASE("char_to_printable_string", "[to_string]")
 {
 #define MAKE_TESTS(PREFIX)                                                                                             \
@@ -33,9 +35,46 @@ TEST_CASE("char_to_printable_string", "[to_string]")
     PREFIX##CHECK(bs::char_to_printable_string('\0') == R"(\0)");                                                      \
     PREFIX##CHECK(bs::char_to_printable_string('\x1') == R"(\x01)");                                                   \
     PREFIX##CHECK(bs::char_to_printable_string('\x7f') == R"(\x7f)");                                                  \
-    PREFIX##CHECK(bs::char_to_printable_string('\n') == R"(\n)");
+    PREFIX##CHECK(bs::char_to_printable_string('\n') == R"(\n)");                                                      \
+    PREFIX##CHECK(bs::char_to_printable_string('\x1f') == "\x1f");                                                     \
+    PREFIX##CHECK(bs::char_to_printable_string(L'a') == R"(\x00000061)");                                              \
+    PREFIX##CHECK(bs::char_to_printable_string(u'\u00e9') == R"(\x00e9)");                                             \
+    PREFIX##CHECK(bs::char_to_printable_string(U'\\') == R"(\\)");                                                     \
+    PREFIX##CHECK(bs::char_to_printable_string(u8'a') == "a");
 
     MAKE_TESTS()
     MAKE_TESTS(STATIC_)
 #undef MAKE_TESTS
-}
\ No newline at end of file
+}
+
+template<typename CharT>
+constexpr auto prefix_length_with_escape_at(std::size_t pos, CharT escape) -> std::size_t
+{
+    std::array<CharT, 24> str;
+    str.fill(CharT{'a'});
+    str[pos] = escape;
+    return bs::printable_prefix_length(str.data(), str.size());
+}
+
+TEST_CASE("printable_prefix_length", "[to_string]")
+{
+    STATIC_CHECK(bs::printable_prefix_length("", 0) == 0);
+    STATIC_CHECK(bs::printable_prefix_length("abc\x1f\x80", 5) == 5);
+    STATIC_CHECK(prefix_length_with_escape_at(3, '\n') == 3);
+    STATIC_CHECK(prefix_length_with_escape_at(17, u'\u00e9') == 17);
+    STATIC_CHECK(bs::printable_prefix_length(L"abc", 3) == 0);
+
+    for (std::size_t pos = 0; pos < 24; ++pos)
+    {
+        CAPTURE(pos);
+        for (char const c : {'\0', '\x1e', '\\', '\x7f'})
+            CHECK(prefix_length_with_escape_at(pos, c) == pos);
+        CHECK(prefix_length_with_escape_at(pos, '\x1f') == 24);
+        CHECK(prefix_length_with_escape_at(pos, '\xe9') == 24);
+        CHECK(prefix_length_with_escape_at(pos, u8'\\') == pos);
+        CHECK(prefix_length_with_escape_at(pos, u'\x7f') == pos);
+        CHECK(prefix_length_with_escape_at(pos, u'\u0100') == pos);
+        CHECK(prefix_length_with_escape_at(pos, U'\t') == pos);
+        CHECK(prefix_length_with_escape_at(pos, U'\U0001f970') == pos);
+    }
+}
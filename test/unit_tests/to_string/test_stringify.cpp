@@ -25,6 +25,14 @@
 
 #include <catch2/catch_all.hpp>
 
+#include <iomanip>
+#include <ios>
+#include <locale>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
 namespace ns
 {
 struct foo
@@ -39,6 +47,53 @@ struct baz
 struct bam
 {
 };
+struct streamable_hex
+{
+    int value;
+};
+struct streamable_int
+{
+    int value;
+};
+struct streamable_nested
+{
+};
+struct streamable_nested_hex
+{
+};
+struct streamable_messy
+{
+};
+
+struct thousands_separator : std::numpunct<char>
+{
+  protected:
+    auto do_thousands_sep() const -> char override { return ','; }
+    auto do_grouping() const -> std::string override { return "\3"; }
+};
+
+auto operator<<(std::ostream& os, streamable_hex const& s) -> std::ostream&
+{
+    return os << std::hex << s.value;
+}
+auto operator<<(std::ostream& os, streamable_int const& s) -> std::ostream&
+{
+    return os << s.value;
+}
+auto operator<<(std::ostream& os, streamable_nested const&) -> std::ostream&
+{
+    return os << "[" << std::string_view{bs::stringify(streamable_hex{255})} << "]";
+}
+auto operator<<(std::ostream& os, streamable_nested_hex const&) -> std::ostream&
+{
+    return os << std::hex << std::string_view{bs::stringify(streamable_int{255})} << " " << 255;
+}
+auto operator<<(std::ostream& os, streamable_messy const&) -> std::ostream&
+{
+    os.imbue(std::locale{std::locale::classic(), new thousands_separator});
+    os.exceptions(std::ios_base::badbit);
+    return os << std::uppercase << std::showpos << std::setprecision(2) << std::setfill('*') << std::setw(8) << 1.0;
+}
 
 constexpr auto to_string(foo const&) -> bs::string
 {
@@ -90,11 +145,35 @@ TEST_CASE("stringify", "[to_string]")
     PREFIX##CHECK(bs::stringify(42) == R"(42)");                                                                       \
     PREFIX##CHECK(bs::stringify(nullptr) == R"(nullptr)");                                                             \
     PREFIX##CHECK(bs::stringify(std::integral_constant<int, 42>{}) == R"(42)");                                        \
-    PREFIX##CHECK(bs::stringify(std::false_type{}) == R"(false)");
-
-    CHECK(bs::stringify(42.1) == R"(42.1)"); // TODO: Add static check once constexpr to_string(double) is implemented
+    PREFIX##CHECK(bs::stringify(std::false_type{}) == R"(false)");                                                     \
+    PREFIX##CHECK(bs::stringify(42.1) == R"(42.1)");
 
     MAKE_TESTS()
     MAKE_TESTS(STATIC_)
 #undef MAKE_TESTS
-}
\ No newline at end of file
+}
+
+TEST_CASE("stringify using operator<<", "[to_string]")
+{
+    CHECK(bs::stringify(ns::streamable_hex{255}) == "ff");
+    CHECK(bs::stringify(ns::streamable_nested{}) == "[ff]");
+    CHECK(bs::stringify(ns::streamable_nested_hex{}) == "255 ff");
+    CHECK(bs::stringify(std::vector{ns::streamable_hex{10}, ns::streamable_hex{11}}) == "{ a, b }");
+
+    SECTION("formatting state is reset")
+    {
+        CHECK(bs::stringify(ns::streamable_hex{16}) == "10");
+        CHECK(bs::stringify(ns::streamable_int{16}) == "16");
+        CHECK(bs::stringify(ns::streamable_messy{}) == "******+1");
+        CHECK(bs::stringify(ns::streamable_int{1000}) == "1000");
+        CHECK(bs::stringify(ns::streamable_hex{255}) == "ff");
+    }
+    SECTION("uses the current global locale")
+    {
+        auto const previous = std::locale::global(std::locale{std::locale::classic(), new ns::thousands_separator});
+        auto const grouped  = bs::stringify(ns::streamable_int{1000});
+        std::locale::global(previous);
+        CHECK(grouped == "1,000");
+        CHECK(bs::stringify(ns::streamable_int{1000}) == "1000");
+    }
+}
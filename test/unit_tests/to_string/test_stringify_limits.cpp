@@ -0,0 +1,98 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "bugspray/to_string/stringify.hpp"
+#include "bugspray/to_string/stringify_limits.hpp"
+#include "bugspray/utility/vector.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <string_view>
+
+namespace
+{
+constexpr auto make_vector(int n) -> bs::vector<int>
+{
+    bs::vector<int> result;
+    for (int i = 0; i < n; ++i)
+        result.push_back(i % 10);
+    return result;
+}
+
+constexpr auto make_string(std::size_t n) -> bs::string
+{
+    bs::string result;
+    for (std::size_t i = 0; i < n; ++i)
+        result.push_back('a');
+    return result;
+}
+} // namespace
+
+TEST_CASE("stringify_limits", "[to_string]")
+{
+    SECTION("compile time limits apply during constant evaluation")
+    {
+        STATIC_REQUIRE(bs::compile_eval_stringify_limits.max_expansion_length == 1000);
+        STATIC_REQUIRE(bs::compile_eval_stringify_limits.max_container_elements == 32);
+        STATIC_REQUIRE(bs::compile_eval_stringify_limits.max_string_length == 200);
+        STATIC_REQUIRE(std::string_view{bs::stringify(make_vector(32))}.ends_with(", 1 }"));
+        STATIC_REQUIRE(std::string_view{bs::stringify(make_vector(35))}.ends_with(", 1, ...(3 more) }"));
+        STATIC_REQUIRE(std::string_view{bs::stringify(make_string(202))}.ends_with("aa\"...(2 more)"));
+    }
+
+    SECTION("default runtime limits")
+    {
+        auto const previous_limits = bs::g_stringify_limits;
+        bs::g_stringify_limits     = bs::stringify_limits{};
+
+        CHECK(bs::stringify(make_vector(10'003)).size() < 40'000);
+        CHECK(std::string_view{bs::stringify(make_vector(10'003))}.ends_with(", ...(3 more) }"));
+        CHECK(std::string_view{bs::stringify(make_string(10'002))}.ends_with("aa\"...(2 more)"));
+
+        bs::g_stringify_limits = previous_limits;
+    }
+
+    SECTION("runtime limits")
+    {
+        auto const previous_limits = bs::g_stringify_limits;
+        bs::g_stringify_limits     = bs::stringify_limits{
+            .max_expansion_length   = 30,
+            .max_container_elements = 3,
+            .max_string_length      = 2,
+        };
+
+        CHECK(bs::stringify(make_vector(3)) == "{ 0, 1, 2 }");
+        CHECK(bs::stringify(make_vector(5)) == "{ 0, 1, 2, ...(2 more) }");
+        CHECK(bs::stringify(bs::vector<int>{}) == "{  }");
+        CHECK(bs::stringify(std::string_view{"ab"}) == R"("ab")");
+        CHECK(bs::stringify(std::string_view{"abcd"}) == R"("ab"...(2 more))");
+        CHECK(bs::stringify(bs::vector<bs::vector<int>>{make_vector(5), make_vector(5)})
+              == "{ { 0, 1, 2, ...(2 more) }, { ...");
+
+        bs::g_stringify_limits.max_container_elements = 0;
+        CHECK(bs::stringify(make_vector(5)) == "{ ...(5 more) }");
+
+        bs::g_stringify_limits = previous_limits;
+    }
+}
@@ -0,0 +1,109 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "bugspray/to_string/stringify.hpp"
+#include "bugspray/utility/structural_buffer.hpp"
+#include "bugspray/utility/vector.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <optional>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <variant>
+
+namespace ns_sink
+{
+struct point
+{
+    int x;
+    int y;
+};
+
+template<bs::string_sink Sink>
+constexpr void format_to(Sink& sink, point const& p)
+{
+    sink.push_back('(');
+    bs::stringify_to(sink, p.x);
+    sink.push_back('|');
+    bs::stringify_to(sink, p.y);
+    sink.push_back(')');
+}
+
+struct overridden
+{
+};
+
+template<bs::string_sink Sink>
+constexpr void format_to(Sink& sink, overridden const&)
+{
+    sink.append("format_to");
+}
+} // namespace ns_sink
+
+namespace bs
+{
+constexpr auto to_string(to_string_override_tag, ns_sink::overridden const&) -> bs::string
+{
+    return "override";
+}
+} // namespace bs
+
+template<typename T>
+constexpr auto stringify_to_string(T const& thing) -> bs::string
+{
+    bs::string result;
+    bs::stringify_to(result, thing);
+    return result;
+}
+
+TEST_CASE("stringify_to", "[to_string]")
+{
+#define MAKE_TESTS(PREFIX)                                                                                             \
+    PREFIX##CHECK(stringify_to_string(42) == "42");                                                                    \
+    PREFIX##CHECK(stringify_to_string(bs::vector<int>{1, 2, 3}) == "{ 1, 2, 3 }");                                     \
+    PREFIX##CHECK(stringify_to_string(bs::vector<char>{'a', 'b'}) == R"("ab")");                                       \
+    PREFIX##CHECK(stringify_to_string(std::pair{1, std::optional<int>{}}) == "{ 1, { nullopt } }");                    \
+    PREFIX##CHECK(stringify_to_string(std::tuple{true, 'a', std::variant<int, bool>{2}}) == "{ true, 'a', { 2 } }");   \
+    PREFIX##CHECK(stringify_to_string(ns_sink::point{1, 2}) == "(1|2)");                                               \
+    PREFIX##CHECK(bs::stringify(ns_sink::point{1, 2}) == "(1|2)");                                                    \
+    PREFIX##CHECK(bs::stringify(bs::vector<ns_sink::point>{{1, 2}, {3, 4}}) == "{ (1|2), (3|4) }");                   \
+    PREFIX##CHECK(stringify_to_string(ns_sink::overridden{}) == "override");
+
+    MAKE_TESTS()
+    MAKE_TESTS(STATIC_)
+#undef MAKE_TESTS
+
+    SECTION("into a structural_buffer")
+    {
+        constexpr auto buffer = []
+        {
+            bs::structural_buffer<32> result;
+            bs::stringify_to(result, std::pair{ns_sink::point{1, 2}, 3});
+            return result;
+        }();
+        STATIC_REQUIRE(buffer == "{ (1|2), 3 }");
+    }
+}
@@ -25,7 +25,10 @@
 
 #include <catch2/catch_all.hpp>
 
+#include <array>
+#include <limits>
 #include <numbers>
+#include <string_view>
 
 template<std::chars_format Format, typename Out>
 auto from_str(bs::string const& str) -> Out
@@ -87,4 +90,87 @@ TEST_CASE("to_string(floating_point)", "[to_string]")
     test(std::numeric_limits<long double>::max());
     test(std::numeric_limits<long double>::min());
     test(std::numeric_limits<long double>::lowest());
-}
\ No newline at end of file
+    test(0.1f);
+    test(std::numbers::pi_v<float>);
+    test(0.1L);
+    test(std::numbers::pi_v<long double>);
+}
+
+TEST_CASE("to_string(floating_point) shortest representation", "[to_string]")
+{
+    using enum std::chars_format;
+#define MAKE_TESTS(PREFIX)                                                                                             \
+    PREFIX##CHECK(bs::to_string(0.0) == "0");                                                                          \
+    PREFIX##CHECK(bs::to_string<scientific>(0.0) == "0e+00");                                                          \
+    PREFIX##CHECK(bs::to_string<hex>(-0.0) == "-0p+0");                                                                \
+    PREFIX##CHECK(bs::to_string(42.1) == "42.1");                                                                      \
+    PREFIX##CHECK(bs::to_string<scientific>(42.1) == "4.21e+01");                                                      \
+    PREFIX##CHECK(bs::to_string<fixed>(42.1) == "42.1");                                                               \
+    PREFIX##CHECK(bs::to_string<hex>(42.1) == "1.50ccccccccccdp+5");                                                   \
+    PREFIX##CHECK(bs::to_string(-1.5) == "-1.5");                                                                      \
+    PREFIX##CHECK(bs::to_string<hex>(-1.5) == "-1.8p+0");                                                              \
+    PREFIX##CHECK(bs::to_string(0.1) == "0.1");                                                                        \
+    PREFIX##CHECK(bs::to_string(1.0 / 3) == "0.3333333333333333");                                                     \
+    PREFIX##CHECK(bs::to_string(100000.0) == "1e+05");                                                                 \
+    PREFIX##CHECK(bs::to_string(1234567.0) == "1234567");                                                              \
+    PREFIX##CHECK(bs::to_string(1234567.5) == "1234567.5");                                                            \
+    PREFIX##CHECK(bs::to_string(1200000.0) == "1200000");                                                              \
+    PREFIX##CHECK(bs::to_string(0.0001) == "1e-04");                                                                   \
+    PREFIX##CHECK(bs::to_string(0.00012) == "0.00012");                                                                \
+    PREFIX##CHECK(bs::to_string(0.00001) == "1e-05");                                                                  \
+    PREFIX##CHECK(bs::to_string(1e23) == "1e+23");                                                                     \
+    PREFIX##CHECK(bs::to_string<fixed>(1e23) == "99999999999999991611392");                                            \
+    PREFIX##CHECK(bs::to_string(5e-324) == "5e-324");                                                                  \
+    PREFIX##CHECK(bs::to_string<hex>(5e-324) == "0.0000000000001p-1022");                                              \
+    PREFIX##CHECK(bs::to_string(std::numeric_limits<double>::max()) == "1.7976931348623157e+308");                     \
+    PREFIX##CHECK(bs::to_string(std::numeric_limits<double>::infinity()) == "inf");                                    \
+    PREFIX##CHECK(bs::to_string(-std::numeric_limits<double>::infinity()) == "-inf");                                  \
+    PREFIX##CHECK(bs::to_string(std::numeric_limits<double>::quiet_NaN()) == "nan");                                   \
+    PREFIX##CHECK(bs::to_string(0.1f) == "0.1");                                                                       \
+    PREFIX##CHECK(bs::to_string<hex>(0.1f) == "1.99999ap-4");                                                          \
+    PREFIX##CHECK(bs::to_string(std::numeric_limits<float>::max()) == "3.4028235e+38");                                \
+    PREFIX##CHECK(bs::to_string<hex>(std::numeric_limits<float>::denorm_min()) == "0.000002p-126");                    \
+    PREFIX##CHECK(bs::to_string(0.1L) == "0.1");                                                                       \
+    PREFIX##CHECK(bs::to_string<scientific>(-2.5L) == "-2.5e+00");
+
+    MAKE_TESTS()
+    MAKE_TESTS(STATIC_)
+#undef MAKE_TESTS
+}
+
+TEST_CASE("to_string(floating_point) matches std::to_chars", "[to_string]")
+{
+    // to_string uses std::to_chars at runtime, so the exact formatting used during constant evaluation is compared
+    auto const check = []<std::chars_format Format>(auto n)
+    {
+        std::array<char, 5000> buffer{};
+        auto const [ptr, ec] = Format == std::chars_format::general
+                                   ? std::to_chars(buffer.data(), buffer.data() + buffer.size(), n)
+                                   : std::to_chars(buffer.data(), buffer.data() + buffer.size(), n, Format);
+        auto const expected  = bs::string{std::string_view{buffer.data(), ptr}};
+        auto const actual    = bs::detail::to_string_exact<Format>(n);
+        CAPTURE(n);
+        CHECK(actual == expected);
+    };
+
+    auto value = 1.0;
+    for (int i = 0; i < 100; ++i, value *= -1.7)
+    {
+        check.operator()<std::chars_format::general>(value);
+        check.operator()<std::chars_format::scientific>(value);
+        check.operator()<std::chars_format::fixed>(value);
+        check.operator()<std::chars_format::hex>(value);
+        check.operator()<std::chars_format::general>(1 / value);
+        check.operator()<std::chars_format::scientific>(1 / value);
+        check.operator()<std::chars_format::fixed>(1 / value);
+        check.operator()<std::chars_format::general>(static_cast<float>(value));
+        check.operator()<std::chars_format::scientific>(static_cast<float>(value));
+        check.operator()<std::chars_format::fixed>(static_cast<float>(value));
+        check.operator()<std::chars_format::hex>(static_cast<float>(value));
+    }
+    for (auto power = 1e-8; power < 1e25; power *= 10)
+    {
+        check.operator()<std::chars_format::general>(power);
+        check.operator()<std::chars_format::general>(12 * power);
+    }
+}
@@ -40,12 +40,23 @@ TEST_CASE("to_string(integral)", "[to_string]")
     PREFIX##CHECK(bs::to_string<16>(-10) == "-a");                                                                     \
     PREFIX##CHECK(bs::to_string<36>(35) == "z");                                                                       \
     PREFIX##CHECK(bs::to_string<16, 2>(3) == "03");                                                                    \
-    PREFIX##CHECK(bs::to_string<10, 3>(std::integral_constant<int, 42>{}) == "042");
+    PREFIX##CHECK(bs::to_string<10, 3>(std::integral_constant<int, 42>{}) == "042");                                  \
+    PREFIX##CHECK(bs::to_string(99) == "99");                                                                          \
+    PREFIX##CHECK(bs::to_string(100) == "100");                                                                        \
+    PREFIX##CHECK(bs::to_string(1234567) == "1234567");                                                                \
+    PREFIX##CHECK(bs::to_string(-9876543210LL) == "-9876543210");                                                      \
+    PREFIX##CHECK(bs::to_string<10, 4>(-7) == "-0007");                                                                \
+    PREFIX##CHECK(bs::to_string<2>(10) == "1010");                                                                     \
+    PREFIX##CHECK(bs::to_string<8>(511u) == "777");                                                                    \
+    PREFIX##CHECK(bs::to_string<16>(0xdeadbeefu) == "deadbeef");                                                       \
+    PREFIX##CHECK(bs::to_string<3>(-5) == "-12");                                                                      \
+    PREFIX##CHECK(bs::to_string<2, 70>(1).size() == 70);
 
     auto const max = std::numeric_limits<std::uintmax_t>::max();
     auto const min = std::numeric_limits<std::intmax_t>::min();
     CHECK(bs::to_string(max) == bs::string{std::to_string(max)});
     CHECK(bs::to_string(min) == bs::string{std::to_string(min)});
+    CHECK(bs::to_string<2>(max) == bs::string{std::string(std::numeric_limits<std::uintmax_t>::digits, '1')});
 
     MAKE_TESTS()
     MAKE_TESTS(STATIC_)
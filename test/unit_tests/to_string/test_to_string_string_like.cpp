@@ -25,6 +25,9 @@
 
 #include <catch2/catch_all.hpp>
 
+#include <list>
+#include <string_view>
+
 TEST_CASE("to_string(string-like)", "[to_string]")
 {
     constexpr char const* test_cstr = "foobar";
@@ -41,9 +44,21 @@ TEST_CASE("to_string(string-like)", "[to_string]")
     PREFIX##CHECK(bs::to_string(u"\U0001f970") == R"("\xd83e\xdd70")");                                                \
     PREFIX##CHECK(bs::to_string(U"\u2665") == R"("\x00002665")");                                                      \
     PREFIX##CHECK(bs::to_string(U"\U0001f970") == R"("\x0001f970")");                                                  \
-    PREFIX##CHECK(bs::to_string(test_cstr) == R"("foobar")");
+    PREFIX##CHECK(bs::to_string(test_cstr) == R"("foobar")");                                                          \
+    PREFIX##CHECK(bs::to_string(std::string_view{"0123456789abcdef\\x"}) == R"("0123456789abcdef\\x")");               \
+    PREFIX##CHECK(bs::to_string(std::string_view{"abcdefghij\x7f\x1e\x1f"}) == "\"abcdefghij\\x7f\\x1e\x1f\"");        \
+    PREFIX##CHECK(bs::to_string(u8"abcdefgh\\") == R"("abcdefgh\\")");                                                 \
+    PREFIX##CHECK(bs::to_string(u"abcdefgh\u00e9") == R"("abcdefgh\x00e9")");                                          \
+    PREFIX##CHECK(bs::to_string(U"abc\td") == R"("abc\td")");                                                          \
+    PREFIX##CHECK(bs::to_string(static_cast<char const*>(nullptr)) == "nullptr");
 
     MAKE_TESTS()
     MAKE_TESTS(STATIC_)
 #undef MAKE_TESTS
+
+    CHECK(bs::to_string(std::list<char>{'a', '\n'}) == R"("a\n")");
+
+    bs::string const long_string{std::string(1000, 'x') + "\n" + std::string(1000, 'y')};
+    auto const       expected = "\"" + std::string(1000, 'x') + R"(\n)" + std::string(1000, 'y') + "\"";
+    CHECK(bs::to_string(long_string) == bs::string{expected});
 }
\ No newline at end of file
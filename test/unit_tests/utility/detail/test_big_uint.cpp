@@ -0,0 +1,79 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "bugspray/utility/detail/big_uint.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <compare>
+#include <utility>
+
+#include <cstdint>
+
+using big = bs::detail::big_uint<8>;
+
+TEST_CASE("big_uint", "[utility]")
+{
+#define MAKE_TESTS(PREFIX)                                                                                             \
+    PREFIX##CHECK(big{}.is_zero());                                                                                    \
+    PREFIX##CHECK(big{0}.is_zero());                                                                                   \
+    PREFIX##CHECK(big{}.bit_width() == 0);                                                                             \
+    PREFIX##CHECK(big{0x1'0000'0000}.bit_width() == 33);                                                               \
+    PREFIX##CHECK(big{6}.is_even());                                                                                   \
+    PREFIX##CHECK(big{6}.bit(1));                                                                                      \
+    PREFIX##CHECK(!big{6}.bit(0));                                                                                     \
+    PREFIX##CHECK(!big{6}.bit(200));                                                                                   \
+    PREFIX##CHECK(big{0xffff'ffff} + big{1} == big{0x1'0000'0000});                                                    \
+    PREFIX##CHECK((big{0x1'0000'0000} -= big{1}) == big{0xffff'ffff});                                                 \
+    PREFIX##CHECK((big{3} <<= 33) == big{0x6'0000'0000});                                                              \
+    PREFIX##CHECK((big{1} <<= 64) > big{0xffff'ffff'ffff'ffff});                                                       \
+    PREFIX##CHECK(((big{1} <<= 64) -= big{1}) == big{0xffff'ffff'ffff'ffff});                                          \
+    PREFIX##CHECK((big{0xffff'ffff} *= 0xffff'ffffu) == big{0xffff'fffe'0000'0001});                                   \
+    PREFIX##CHECK((big{7} *= 0) == big{});                                                                             \
+    PREFIX##CHECK(big{1}.multiply_pow10(19) == big{10'000'000'000'000'000'000u});                                      \
+    PREFIX##CHECK(big{3} < big{0x1'0000'0000});                                                                        \
+    PREFIX##CHECK(std::is_eq(compare_sum(big{0xffff'ffff}, big{1}, big{0x1'0000'0000})));                              \
+    PREFIX##CHECK(std::is_lt(compare_sum(big{0xffff'ffff}, big{0}, big{0x1'0000'0000})));                              \
+    PREFIX##CHECK(std::is_gt(compare_sum(big{0xffff'ffff}, big{2}, big{0x1'0000'0000})));
+
+    MAKE_TESTS()
+    MAKE_TESTS(STATIC_)
+#undef MAKE_TESTS
+
+    SECTION("divide_small_quotient")
+    {
+        constexpr auto remainder_and_quotient = [](big dividend, big const& divisor)
+        {
+            auto const quotient = dividend.divide_small_quotient(divisor);
+            return std::pair{dividend, quotient};
+        };
+        auto const divisor = big{1}.multiply_pow10(30) += big{7};
+        auto       dividend = divisor;
+        dividend *= 9;
+        dividend += big{5};
+
+        STATIC_CHECK(remainder_and_quotient(big{47}, big{5}) == std::pair{big{2}, 9u});
+        STATIC_CHECK(remainder_and_quotient(big{4}, big{5}) == std::pair{big{4}, 0u});
+        CHECK(remainder_and_quotient(dividend, divisor) == std::pair{big{5}, 9u});
+    }
+}
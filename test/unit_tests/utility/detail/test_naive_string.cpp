@@ -25,6 +25,10 @@
 
 #include <catch2/catch_all.hpp>
 
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
 using namespace bs;
 
 TEST_CASE("naive_string", "[utility][detail]")
@@ -58,6 +62,91 @@ TEST_CASE("naive_string", "[utility][detail]")
         STATIC_REQUIRE(test().size() == 6);
         STATIC_REQUIRE(test() == "foobar");
     }
+    SECTION("can grow beyond its inline capacity")
+    {
+        constexpr auto test = []()
+        {
+            naive_string v;
+            for (std::size_t i = 0; i < 2 * naive_string::inline_capacity; ++i)
+                v.push_back(static_cast<char>('a' + i % 26));
+            return v;
+        };
+        STATIC_REQUIRE(test().size() == 2 * naive_string::inline_capacity);
+        STATIC_REQUIRE(test() == "abcdefghijklmnopqrstuvwxyzabcd");
+        STATIC_REQUIRE(test().c_str()[test().size()] == '\0');
+    }
+    SECTION("can append to it")
+    {
+        constexpr auto test = []()
+        {
+            naive_string v = "foo";
+            v.append("bar").append(std::string_view{"0123456789abcdef"});
+            v += 'x';
+            return v;
+        };
+        STATIC_REQUIRE(test() == "foobar0123456789abcdefx");
+    }
+    SECTION("can append itself")
+    {
+        constexpr auto test = []()
+        {
+            naive_string v = "0123456789";
+            v.append(v);
+            v += v;
+            return v;
+        };
+        STATIC_REQUIRE(test() == "0123456789012345678901234567890123456789");
+    }
+    SECTION("can reserve capacity")
+    {
+        constexpr auto test = []()
+        {
+            naive_string v = "foo";
+            v.reserve(100);
+            auto const data = v.data();
+            for (int i = 0; i < 90; ++i)
+                v.push_back('x');
+            return std::pair{v.capacity(), data == v.data() && v.size() == 93 && v[2] == 'o'};
+        };
+        STATIC_REQUIRE(test().first == 100);
+        STATIC_REQUIRE(test().second);
+    }
+    SECTION("can't grow beyond max_size")
+    {
+        naive_string v = "foo";
+        REQUIRE_THROWS_AS(v.reserve(naive_string::max_size() + 1), std::length_error);
+        REQUIRE(v == "foo");
+    }
+    SECTION("can copy and move it")
+    {
+        constexpr auto test = [](std::string_view sv)
+        {
+            naive_string const v{sv};
+            naive_string       copy = v;
+            naive_string       moved{std::move(copy)};
+            naive_string       assigned;
+            assigned = v;
+            assigned = std::move(moved);
+            return assigned == v && copy.empty();
+        };
+        STATIC_REQUIRE(test("short"));
+        STATIC_REQUIRE(test("long enough to be stored on the heap"));
+    }
+    SECTION("can concatenate rvalues")
+    {
+        constexpr auto test = []()
+        {
+            naive_string const v = "bar";
+            return naive_string{"foo"} + v + "baz" + '!' + ("qux" + v);
+        };
+        STATIC_REQUIRE(test() == "foobarbaz!quxbar");
+    }
+    SECTION("short strings can be constexpr variables")
+    {
+        constexpr naive_string v = "foo";
+        STATIC_REQUIRE(v.size() == 3);
+        STATIC_REQUIRE(std::string_view{v} == "foo");
+    }
     SECTION("can compare for equality")
     {
         STATIC_REQUIRE(naive_string{"foo"} == naive_string{"foo"});
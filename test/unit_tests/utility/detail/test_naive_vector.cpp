@@ -25,8 +25,32 @@
 
 #include <catch2/catch_all.hpp>
 
+#include <algorithm>
+#include <utility>
+
 using namespace bs;
 
+namespace
+{
+struct copy_counter
+{
+    constexpr copy_counter() = default;
+    constexpr copy_counter(copy_counter const& other)
+        : copies(other.copies + 1)
+    {
+    }
+    constexpr copy_counter(copy_counter&&) noexcept = default;
+    constexpr auto operator=(copy_counter const& other) -> copy_counter&
+    {
+        copies = other.copies + 1;
+        return *this;
+    }
+    constexpr auto operator=(copy_counter&&) noexcept -> copy_counter& = default;
+
+    int copies = 0;
+};
+} // namespace
+
 TEST_CASE("naive_vector", "[utility][detail]")
 {
     SECTION("default construction leaves it empty")
@@ -65,6 +89,72 @@ TEST_CASE("naive_vector", "[utility][detail]")
         STATIC_REQUIRE(test()[2] == 1);
         STATIC_REQUIRE(test()[3] == 3);
     }
+    SECTION("can insert into it by moving")
+    {
+        constexpr auto test = []()
+        {
+            naive_vector<copy_counter> v;
+            v.insert(v.end(), copy_counter{});
+            v.insert(v.begin(), copy_counter{});
+            v.insert(v.begin() + 1, copy_counter{});
+            v.emplace_back();
+            v.push_back(copy_counter{});
+            return v;
+        };
+        STATIC_REQUIRE(test().size() == 5);
+        STATIC_REQUIRE(std::ranges::all_of(test(), [](copy_counter const& c) { return c.copies == 0; }));
+    }
+    SECTION("can push one of its own elements")
+    {
+        constexpr auto test = []()
+        {
+            naive_vector<naive_vector<int>> v;
+            v.push_back(naive_vector<int>{1, 2, 3});
+            v.push_back(v.front());
+            v.push_back(v.back());
+            v.insert(v.begin(), v.back());
+            return v;
+        };
+        STATIC_REQUIRE(test().size() == 4);
+        STATIC_REQUIRE(std::ranges::all_of(test(), [](auto const& e) { return e == naive_vector<int>{1, 2, 3}; }));
+    }
+    SECTION("can reserve capacity")
+    {
+        constexpr auto test = []()
+        {
+            naive_vector<int> v{1, 2};
+            v.reserve(10);
+            auto const data = v.data();
+            for (int i = 0; i < 8; ++i)
+                v.push_back(i);
+            return std::pair{v.capacity(), data == v.data() && v[1] == 2 && v[9] == 7};
+        };
+        STATIC_REQUIRE(test().first == 10);
+        STATIC_REQUIRE(test().second);
+    }
+    SECTION("can erase from it")
+    {
+        constexpr auto test = []()
+        {
+            naive_vector<int> v{1, 2, 3, 4, 5, 6};
+            auto const        iter = v.erase(v.begin() + 1);
+            v.erase(v.begin() + 2, v.begin() + 4);
+            return std::pair{v, *iter == 3};
+        };
+        STATIC_REQUIRE(test().first == naive_vector<int>{1, 3, 6});
+        STATIC_REQUIRE(test().second);
+    }
+    SECTION("can clear it")
+    {
+        constexpr auto test = []()
+        {
+            naive_vector<int> v{1, 2, 3};
+            v.clear();
+            v.push_back(4);
+            return v;
+        };
+        STATIC_REQUIRE(test() == naive_vector<int>{4});
+    }
     SECTION("can pop from it")
     {
         constexpr auto test = []()
@@ -0,0 +1,91 @@
+//
+// MIT License
+//
+// Copyright (c) 2026 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "bugspray/utility/structural_buffer.hpp"
+
+#include <catch2/catch_all.hpp>
+
+#include <string_view>
+
+using namespace bs;
+
+template<structural_buffer B>
+struct bar
+{
+    static constexpr std::string_view str = std::string_view{B};
+};
+
+TEST_CASE("structural_buffer", "[utility]")
+{
+    SECTION("default construct")
+    {
+        STATIC_REQUIRE(structural_buffer<15>{} == "");
+        STATIC_REQUIRE(structural_buffer<15>{}.size() == 0);
+        STATIC_REQUIRE(structural_buffer<15>{}.capacity() == 15);
+    }
+    SECTION("append")
+    {
+        constexpr auto buffer = []
+        {
+            structural_buffer<16> result;
+            result.append("foo").append('-').append(std::string_view{"bar"});
+            return result;
+        }();
+        STATIC_REQUIRE(buffer == "foo-bar");
+        STATIC_REQUIRE(buffer.size() == 7);
+    }
+    SECTION("append beyond capacity")
+    {
+        constexpr auto buffer = []
+        {
+            structural_buffer<4> result;
+            result.append("foo").append("bar").append('!');
+            return result;
+        }();
+        STATIC_REQUIRE(buffer == "foob");
+        STATIC_REQUIRE(buffer.size() == 4);
+    }
+    SECTION("usage as template argument")
+    {
+        static constexpr auto buffer = []
+        {
+            structural_buffer<16> result;
+            result.append("foo");
+            return result;
+        }();
+        STATIC_REQUIRE(bar<buffer>::str == "foo");
+    }
+    SECTION("to_structural_string")
+    {
+        static constexpr auto buffer = []
+        {
+            structural_buffer<2048> result;
+            result.append("foo").append("bar");
+            return result;
+        }();
+        constexpr auto str = to_structural_string<buffer>();
+        STATIC_REQUIRE(str == "foobar");
+        STATIC_REQUIRE(str.capacity() == 7);
+    }
+}